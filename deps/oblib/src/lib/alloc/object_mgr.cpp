@@ -59,6 +59,16 @@ void SubObjectMgr::free_block(ABlock *block)
   bs_.free_block(block);
 }
 
+// Start from the sub mgr of the current cpu rather than of the current thread, so that
+// the free lists and the lock of the sub mgr mostly stay in the cache of that cpu. A thread
+// may be preempted or migrated while holding the lock, so threads of the same cpu can still
+// contend for it: correctness comes from trylock falling back to the other sub mgrs and
+// finally to the root mgr under its lock, the cpu only picks where to start.
+static OB_INLINE uint64_t get_start_idx()
+{
+  return static_cast<uint64_t>(common::icpu_id());
+}
+
 ObjectMgr::ObjectMgr(ObTenantCtxAllocator &allocator, uint64_t tenant_id, uint64_t ctx_id)
   : ta_(allocator), attr_(tenant_id, nullptr, ctx_id),
     sub_cnt_(1),
@@ -88,7 +98,7 @@ void ObjectMgr::reset() {
 AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
 {
   AObject *obj = NULL;
-  const uint64_t start = common::get_itid();
+  const uint64_t start = get_start_idx();
   SubObjectMgr *sub_mgr = nullptr;
   for (uint64_t i = 0; NULL == obj && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
@@ -166,7 +176,7 @@ void ObjectMgr::free_object(AObject *obj)
 ABlock *ObjectMgr::alloc_block(uint64_t size, const ObMemAttr &attr)
 {
   ABlock *block = NULL;
-  const uint64_t start = common::get_itid();
+  const uint64_t start = get_start_idx();
   SubObjectMgr *sub_mgr = nullptr;
   for (uint64_t i = 0; NULL == block && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
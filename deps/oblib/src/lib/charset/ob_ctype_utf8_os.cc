@@ -1814,6 +1814,59 @@ static inline void ob_tosort_unicode(ObUnicaseInfo *uni_plane, ob_wc_t *wc, unsi
   }
 }
 
+// same as ob_tosort_unicode for the ascii characters, which are always in page 0
+static inline ob_wc_t ob_ascii_sort_weight(const ObUnicaseInfoChar *page0, unsigned char c, unsigned int flags)
+{
+  return (flags & OB_CS_LOWER_SORT) ? page0[c].tolower : page0[c].sort;
+}
+
+// Skip the leading 8 bytes words which are equal in both strings and only
+// consist of ascii characters, the characters in them have the same weights.
+static inline void ob_skip_equal_ascii_words(const unsigned char **src, const unsigned char *se,
+                                             const unsigned char **dst, const unsigned char *te)
+{
+  static const uint64_t ASCII_MASK = 0x8080808080808080ULL;
+  uint64_t src_word = 0;
+  uint64_t dst_word = 0;
+  while (se - *src >= 8 && te - *dst >= 8) {
+    memcpy(&src_word, *src, 8);
+    memcpy(&dst_word, *dst, 8);
+    if (src_word != dst_word || 0 != (src_word & ASCII_MASK)) {
+      break;
+    }
+    *src += 8;
+    *dst += 8;
+  }
+}
+
+// decode the next characters of both strings and get their sort weights,
+// return false if either is not a valid character.
+static inline bool ob_next_sort_weights_utf8mb4(const ObCharsetInfo *cs,
+                                                const ObUnicaseInfoChar *page0,
+                                                const unsigned char *src, const unsigned char *se,
+                                                const unsigned char *dst, const unsigned char *te,
+                                                ob_wc_t *src_wc, ob_wc_t *dst_wc,
+                                                int *s_res, int *t_res)
+{
+  bool bret = true;
+  if (*src < 0x80 && *dst < 0x80 && OB_NOT_NULL(page0)) {
+    *src_wc = ob_ascii_sort_weight(page0, *src, cs->state);
+    *dst_wc = ob_ascii_sort_weight(page0, *dst, cs->state);
+    *s_res = 1;
+    *t_res = 1;
+  } else {
+    *s_res = ob_mb_wc_utf8mb4(cs, src_wc, src, se);
+    *t_res = ob_mb_wc_utf8mb4(cs, dst_wc, dst, te);
+    if (*s_res <= 0 || *t_res <= 0) {
+      bret = false;
+    } else {
+      ob_tosort_unicode(cs->caseinfo, src_wc, cs->state);
+      ob_tosort_unicode(cs->caseinfo, dst_wc, cs->state);
+    }
+  }
+  return bret;
+}
+
 static int ob_strnncoll_utf8mb4(const ObCharsetInfo *cs,
                      const unsigned char *src, size_t srclen,
                      const unsigned char *dst, size_t dstlen,
@@ -1822,15 +1875,13 @@ static int ob_strnncoll_utf8mb4(const ObCharsetInfo *cs,
   ob_wc_t src_wc = 0, dst_wc = 0;
   const unsigned char *se = src + srclen;
   const unsigned char *te = dst + dstlen;
-  ObUnicaseInfo *uni_plane = cs->caseinfo;
+  const ObUnicaseInfoChar *page0 = cs->caseinfo->page[0];
+  ob_skip_equal_ascii_words(&src, se, &dst, te);
   while ( src < se && dst < te ) {
-    int s_res = ob_mb_wc_utf8mb4(cs, &src_wc, src, se);
-    int t_res = ob_mb_wc_utf8mb4(cs, &dst_wc, dst, te);
-    if ( s_res <= 0 || t_res <= 0 ) {
+    int s_res = 0, t_res = 0;
+    if (!ob_next_sort_weights_utf8mb4(cs, page0, src, se, dst, te, &src_wc, &dst_wc, &s_res, &t_res)) {
       return bincmp_utf8mb4(src, se, dst, te);
     }
-    ob_tosort_unicode(uni_plane, &src_wc, cs->state);
-    ob_tosort_unicode(uni_plane, &dst_wc, cs->state);
     if ( src_wc != dst_wc ) {
       return src_wc > dst_wc ? 1 : -1;
     } else {
@@ -1892,15 +1943,13 @@ static int ob_strnncollsp_utf8mb4(const ObCharsetInfo *cs,
   int res;
   ob_wc_t src_wc = 0, dst_wc = 0;
   const unsigned char *se= src + srclen, *te= dst + dstlen;
-  ObUnicaseInfo *uni_plane= cs->caseinfo;
+  const ObUnicaseInfoChar *page0 = cs->caseinfo->page[0];
+  ob_skip_equal_ascii_words(&src, se, &dst, te);
   while ( src < se && dst < te ) {
-    int s_res= ob_mb_wc_utf8mb4(cs, &src_wc, src, se);
-    int t_res= ob_mb_wc_utf8mb4(cs, &dst_wc, dst, te);
-    if ( s_res <= 0 || t_res <= 0 ) {
+    int s_res = 0, t_res = 0;
+    if (!ob_next_sort_weights_utf8mb4(cs, page0, src, se, dst, te, &src_wc, &dst_wc, &s_res, &t_res)) {
       return bincmp_utf8mb4(src, se, dst, te);
     }
-    ob_tosort_unicode(uni_plane, &src_wc, cs->state);
-    ob_tosort_unicode(uni_plane, &dst_wc, cs->state);
     if ( src_wc != dst_wc ) {
       return src_wc > dst_wc ? 1 : -1;
     } else {
@@ -2208,6 +2257,23 @@ static inline void ob_hash_add(unsigned long int *n1, unsigned long int *n2, uns
 }
 
 
+// decode the next character and get its sort weight, return the length of the character
+static inline int ob_next_hash_weight_utf8mb4(const ObCharsetInfo *cs,
+                                              const ObUnicaseInfoChar *page0,
+                                              ob_wc_t *wc,
+                                              const unsigned char *src,
+                                              const unsigned char *end)
+{
+  int res = 0;
+  if (src < end && *src < 0x80 && OB_NOT_NULL(page0)) {
+    *wc = ob_ascii_sort_weight(page0, *src, cs->state);
+    res = 1;
+  } else if ((res = ob_mb_wc_utf8mb4(cs, wc, src, end)) > 0) {
+    ob_tosort_unicode(cs->caseinfo, wc, cs->state);
+  }
+  return res;
+}
+
 static void ob_hash_sort_utf8mb4(const ObCharsetInfo *cs, const unsigned char *src, size_t srclen,
                unsigned long int *n1, unsigned long int *n2, const bool calc_end_space, hash_algo hash_algo)
 {
@@ -2215,6 +2281,7 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo *cs, const unsigned char *s
   int res;
   const unsigned char *end= src + srclen;
   ObUnicaseInfo *uni_plane= cs->caseinfo;
+  const ObUnicaseInfoChar *page0 = uni_plane->page[0];
   int length = 0;
   unsigned char data[HASH_BUFFER_LENGTH];
   if (!calc_end_space) {
@@ -2223,8 +2290,7 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo *cs, const unsigned char *s
   }
 
   if (NULL == hash_algo) {
-    while ((res= ob_mb_wc_utf8mb4(cs, &wc, (unsigned char*) src, (unsigned char*) end)) > 0) {
-      ob_tosort_unicode(uni_plane, &wc, cs->state);
+    while ((res= ob_next_hash_weight_utf8mb4(cs, page0, &wc, src, end)) > 0) {
       ob_hash_add(n1, n2, (unsigned int) (wc & 0xFF));
       ob_hash_add(n1, n2, (unsigned int) (wc >> 8)  & 0xFF);
       if (wc > 0xFFFF) {
@@ -2233,8 +2299,7 @@ static void ob_hash_sort_utf8mb4(const ObCharsetInfo *cs, const unsigned char *s
       src+= res;
     }
   } else {
-    while ((res= ob_mb_wc_utf8mb4(cs, &wc, (unsigned char*) src, (unsigned char*) end)) > 0) {
-      ob_tosort_unicode(uni_plane, &wc, cs->state);
+    while ((res= ob_next_hash_weight_utf8mb4(cs, page0, &wc, src, end)) > 0) {
       if (length > HASH_BUFFER_LENGTH - 2 || (HASH_BUFFER_LENGTH - 2 == length && wc > 0xFFFF)) {
         *n1 = hash_algo((void*) &data, length, *n1);
         length = 0;
@@ -14,6 +14,7 @@
 #include "common/object/ob_obj_type.h"
 #include "ob_json_bin.h"
 #include "ob_json_tree.h"
+#include "ob_json_path.h"
 
 namespace oceanbase {
 namespace common {
@@ -2088,6 +2089,132 @@ int ObJsonBin::lookup(const ObString &key)
   return ret;
 }
 
+bool ObJsonBin::is_simple_path(const ObJsonPath &path, uint32_t node_cnt)
+{
+  bool is_simple = node_cnt > 0;
+  JsonPathIterator iter = path.begin();
+  for (uint32_t i = 0; is_simple && i < node_cnt; ++i, ++iter) {
+    ObJsonPathNodeType node_type = (*iter)->get_node_type();
+    is_simple = (node_type == JPN_MEMBER || node_type == JPN_ARRAY_CELL);
+  }
+  return is_simple;
+}
+
+int ObJsonBin::seek(const ObJsonPath &path, uint32_t node_cnt, bool is_auto_wrap,
+                    bool only_need_one, ObJsonBaseVector &res) const
+{
+  INIT_SUCC(ret);
+  ObJsonNodeType node_type = json_type();
+  if (OB_NOT_NULL(allocator_)
+      && (node_type == ObJsonNodeType::J_OBJECT || node_type == ObJsonNodeType::J_ARRAY)
+      && is_simple_path(path, node_cnt)) {
+    // at most one node matches, only_need_one makes no difference
+    if (OB_FAIL(seek_simple_path(path, node_cnt, is_auto_wrap, res))) {
+      LOG_WARN("fail to seek simple path", K(ret), K(node_cnt), K(is_auto_wrap));
+    }
+  } else if (OB_FAIL(ObIJsonBase::seek(path, node_cnt, is_auto_wrap, only_need_one, res))) {
+    LOG_WARN("fail to seek", K(ret), K(node_cnt), K(only_need_one));
+  }
+  return ret;
+}
+
+// Walk the path with an iter without allocator, so neither sub binary nor parent
+// stack is allocated for the intermediate nodes. The result is built the same way
+// as get_object_value/get_array_element on the parent of the matched node.
+int ObJsonBin::seek_simple_path(const ObJsonPath &path, uint32_t node_cnt, bool is_auto_wrap,
+                                ObJsonBaseVector &res) const
+{
+  INIT_SUCC(ret);
+  ObString sub;
+  if (OB_FAIL(raw_binary_at_iter(sub))) {
+    LOG_WARN("fail to get sub json binary.", K(ret));
+  } else {
+    ObJsonBin walker(sub.ptr(), sub.length());
+    bool is_found = true;
+    bool is_moved = false;
+    int64_t parent_pos = 0;
+    uint8_t parent_type = 0;
+    size_t child_idx = 0;
+    JsonPathIterator iter = path.begin();
+    if (OB_FAIL(walker.reset_iter())) {
+      LOG_WARN("fail to reset iter", K(ret));
+    }
+    for (uint32_t i = 0; OB_SUCC(ret) && is_found && i < node_cnt; ++i, ++iter) {
+      const ObJsonPathBasicNode *path_node = static_cast<const ObJsonPathBasicNode *>(*iter);
+      ObJsonNodeType node_type = walker.json_type();
+      size_t idx = 0;
+      bool need_move = false;
+      if (path_node->get_node_type() == JPN_MEMBER) {
+        if (node_type != ObJsonNodeType::J_OBJECT) {
+          is_found = false;
+        } else {
+          ObString key_name(path_node->get_object().len_, path_node->get_object().object_name_);
+          ret = walker.lookup_index(key_name, &idx);
+          if (OB_SUCC(ret)) {
+            need_move = true;
+          } else if (ret == OB_SEARCH_NOT_FOUND) {
+            // not found, it is normal.
+            ret = OB_SUCCESS;
+            is_found = false;
+          } else {
+            LOG_WARN("fail to lookup key", K(ret), K(key_name));
+          }
+        }
+      } else if (node_type == ObJsonNodeType::J_ARRAY) {
+        ObJsonArrayIndex array_idx;
+        if (OB_FAIL(path_node->get_first_array_index(walker.element_count(), array_idx))) {
+          LOG_WARN("failed to get array index.", K(ret), K(walker.element_count()));
+        } else if (!array_idx.is_within_bounds()) {
+          is_found = false;
+        } else {
+          idx = array_idx.get_array_index();
+          need_move = true;
+        }
+      } else if (!(is_auto_wrap && path_node->is_autowrap())) {
+        is_found = false;
+      }
+      if (OB_SUCC(ret) && need_move) {
+        parent_pos = walker.pos_;
+        parent_type = walker.type_;
+        child_idx = idx;
+        is_moved = true;
+        if (OB_FAIL(walker.element(idx))) {
+          LOG_WARN("fail to move iter to child", K(ret), K(i), K(idx));
+        }
+      }
+    }
+
+    if (OB_FAIL(ret) || !is_found) {
+    } else if (!is_moved) {
+      // only autowrap nodes, the current node is the result
+      if (OB_FAIL(res.push_back(const_cast<ObJsonBin *>(this)))) {
+        LOG_WARN("fail to push_back value into result", K(ret), K(res.size()));
+      }
+    } else {
+      void *buf = NULL;
+      ObJsonBin *new_bin = NULL;
+      walker.pos_ = parent_pos;
+      walker.type_ = parent_type;
+      if (OB_FAIL(walker.set_curr_by_type(parent_pos, 0, parent_type))) {
+        LOG_WARN("fail to move iter to parent", K(ret), K(parent_pos), K(parent_type));
+      } else if (OB_FAIL(walker.raw_binary_at_iter(sub))) {
+        LOG_WARN("fail to get sub json binary.", K(ret));
+      } else if (OB_ISNULL(buf = allocator_->alloc(sizeof(ObJsonBin)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc json bin fail", K(ret), K(sizeof(ObJsonBin)));
+      } else if (FALSE_IT(new_bin = new (buf) ObJsonBin(sub.ptr(), sub.length(), allocator_))) {
+      } else if (OB_FAIL(new_bin->reset_iter())) {
+        LOG_WARN("fail to reset iter for new json bin", K(ret));
+      } else if (OB_FAIL(new_bin->element(child_idx))) {
+        LOG_WARN("fail to access child node for new json bin.", K(ret), K(child_idx));
+      } else if (OB_FAIL(res.push_back(new_bin))) {
+        LOG_WARN("fail to push_back value into result", K(ret), K(res.size()));
+      }
+    }
+  }
+  return ret;
+}
+
 void ObJsonBin::parse_obj_header(const char *data, uint64_t &offset,
      uint8_t &node_type, uint8_t &type, uint8_t& obj_size_type, uint64_t &count, uint64_t &obj_size) const
 {
@@ -275,6 +275,14 @@ public:
   */
   int lookup(const ObString &key);
 
+  /*
+  Seek the nodes matching the path, see ObIJsonBase::seek.
+  Paths only made of member and array cell nodes are evaluated by moving a
+  temporary iter in place, only the result node is allocated.
+  */
+  int seek(const ObJsonPath &path, uint32_t node_cnt, bool is_auto_wrap,
+           bool only_need_one, ObJsonBaseVector &res) const override;
+
   /*
   Update child node by key, first try inplace update.
   @param[in] key       The key.
@@ -483,6 +491,10 @@ private:
   int check_valid_array_op(uint64_t index) const;
   int create_new_binary(ObIJsonBase *&value, ObJsonBin *&new_bin) const;
   int get_use_size(uint64_t& used_size) const;
+private:
+  static bool is_simple_path(const ObJsonPath &path, uint32_t node_cnt);
+  int seek_simple_path(const ObJsonPath &path, uint32_t node_cnt, bool is_auto_wrap,
+                       ObJsonBaseVector &res) const;
 /* data */
 private:
   common::ObIAllocator *allocator_;
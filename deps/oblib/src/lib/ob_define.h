@@ -1572,6 +1572,12 @@ const uint32_t NUM_DESC_2DIGITS_POSITIVE_DECIMAL = 0xc0000002;
 const uint32_t NUM_DESC_1DIGIT_POSITIVE_FRAGMENT = 0xbf000001;
 // len_ = 1, se_ = 192: 1 digit integer(e.g 111)
 const uint32_t NUM_DESC_1DIGIT_POSITIVE_INTEGER = 0xc0000001;
+// len_ = 2, se_ = 64: 2 digits(e.g: -111.111)
+const uint32_t NUM_DESC_2DIGITS_NEGATIVE_DECIMAL = 0x40000002;
+// len_ = 1, se_ = 65: 1 digit fragment(e.g -0.111)
+const uint32_t NUM_DESC_1DIGIT_NEGATIVE_FRAGMENT = 0x41000001;
+// len_ = 1, se_ = 64: 1 digit integer(e.g -111)
+const uint32_t NUM_DESC_1DIGIT_NEGATIVE_INTEGER = 0x40000001;
 const int64_t OB_DECIMAL_NOT_SPECIFIED = -1;
 const int64_t OB_MIN_NUMBER_FLOAT_PRECISION = 1;     //Float in Oracle: p[1, 126]
 const int64_t OB_MAX_NUMBER_FLOAT_PRECISION = 126;
@@ -2173,6 +2179,18 @@ struct ObNumberDesc
   {
     return (desc_ == oceanbase::common::NUM_DESC_1DIGIT_POSITIVE_INTEGER);
   }
+  bool is_2d_negative_decimal()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_2DIGITS_NEGATIVE_DECIMAL);
+  }
+  bool is_1d_negative_fragment()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_1DIGIT_NEGATIVE_FRAGMENT);
+  }
+  bool is_1d_negative_integer()
+  {
+    return (desc_ == oceanbase::common::NUM_DESC_1DIGIT_NEGATIVE_INTEGER);
+  }
   union
   {
     uint32_t desc_;
@@ -51,6 +51,9 @@ _RLOCAL(uint64_t, ObLogger::last_logging_seq_);
 _RLOCAL(uint64_t, ObLogger::last_logging_cost_time_us_);
 _RLOCAL(time_t, ObLogger::last_unix_sec_);
 _RLOCAL(struct tm, ObLogger::last_localtime_);
+_RLOCAL(time_t, ObLogger::last_head_sec_);
+_RLOCAL(int32_t, ObLogger::last_head_time_len_);
+_RLOCAL(ByteBuf<ObLogger::HEAD_TIME_BUF_SIZE>, ObLogger::last_head_time_);
 _RLOCAL(bool, ObLogger::disable_logging_);
 _RLOCAL(bool, ObLogger::trace_mode_);
 static int64_t last_check_file_ts = 0; //last file sample timestamps
@@ -638,22 +641,32 @@ int ObLogger::log_head(const char *mod_name,
 
     struct timeval tv;
     (void)gettimeofday(&tv, NULL);
-    struct tm tm;
-    ob_fast_localtime(last_unix_sec_, last_localtime_, static_cast<time_t>(tv.tv_sec), &tm);
+    if (OB_UNLIKELY(static_cast<time_t>(tv.tv_sec) != last_head_sec_ || 0 == last_head_time_len_)) {
+      // the date and time only change once per second, format them once and copy afterwards
+      struct tm tm;
+      int64_t time_len = 0;
+      ob_fast_localtime(last_unix_sec_, last_localtime_, static_cast<time_t>(tv.tv_sec), &tm);
+      (void)logdata_printf(last_head_time_, HEAD_TIME_BUF_SIZE, time_len,
+                           "[%04d-%02d-%02d %02d:%02d:%02d.",
+                           tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
+                           tm.tm_sec);
+      last_head_time_len_ = static_cast<int32_t>(time_len);
+      last_head_sec_ = static_cast<time_t>(tv.tv_sec);
+    }
     const uint64_t *trace_id = ObCurTraceId::get();
     if (get_fd_type(mod_name) == FD_TRACE_FILE) {
       //forbid modify the format of logdata_printf
       ret = logdata_printf(buf, buf_len, pos,
-                           "[%04d-%02d-%02d %02d:%02d:%02d.%06ld] "
+                           "%.*s%06ld] "
                            "[%ld][%s][T%lu][" TRACE_ID_FORMAT_V2 "] ",
-                           tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
-                           tm.tm_sec, tv.tv_usec, GETTID(), GETTNAME(), GET_TENANT_ID(), TRACE_ID_FORMAT_PARAM(trace_id));
+                           last_head_time_len_, last_head_time_,
+                           tv.tv_usec, GETTID(), GETTNAME(), GET_TENANT_ID(), TRACE_ID_FORMAT_PARAM(trace_id));
     } else {
       ret = logdata_printf(buf, buf_len, pos,
-                           "[%04d-%02d-%02d %02d:%02d:%02d.%06ld] "
+                           "%.*s%06ld] "
                            "%-5s %s%s (%s:%d) [%ld][%s][T%lu][" TRACE_ID_FORMAT_V2 "] [lt=%ld] ",
-                           tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
-                           tm.tm_sec, tv.tv_usec, errstr_[level], mod_name, function,
+                           last_head_time_len_, last_head_time_,
+                           tv.tv_usec, errstr_[level], mod_name, function,
                            base_file_name, line, GETTID(), GETTNAME(), GET_TENANT_ID(), TRACE_ID_FORMAT_PARAM(trace_id),
                            last_logging_cost_time_us_);
     }
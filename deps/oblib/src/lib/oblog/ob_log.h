@@ -278,6 +278,11 @@ public:
   //mainly for ob_localtime
   RLOCAL_STATIC(time_t, last_unix_sec_);
   RLOCAL_STATIC(struct tm, last_localtime_);
+  //date and time part of log head, only formatted once per second, e.g. "[2021-06-01 12:00:00."
+  static const int64_t HEAD_TIME_BUF_SIZE = 32;
+  RLOCAL_STATIC(time_t, last_head_sec_);
+  RLOCAL_STATIC(int32_t, last_head_time_len_);
+  RLOCAL_STATIC(ByteBuf<HEAD_TIME_BUF_SIZE>, last_head_time_);
 
   enum UserMsgLevel
   {
@@ -173,6 +173,9 @@ STAT_EVENT_ADD_DEF(SQL_USER_LOGONS_CUMULATIVE, "user logons cumulative", ObStatC
 STAT_EVENT_ADD_DEF(SQL_USER_LOGOUTS_CUMULATIVE, "user logouts cumulative", ObStatClassIds::SQL, "user logouts cumulative", 40113, true, true)
 STAT_EVENT_ADD_DEF(SQL_USER_LOGONS_FAILED_CUMULATIVE, "user logons failed cumulative", ObStatClassIds::SQL, "user logons failed cumulative", 40114, true, true)
 STAT_EVENT_ADD_DEF(SQL_USER_LOGONS_COST_TIME_CUMULATIVE, "user logons time cumulative", ObStatClassIds::SQL, "user logons time cumulative", 40115, true, true)
+STAT_EVENT_ADD_DEF(SQL_FAST_PARSE_COUNT, "sql fast parse count", ObStatClassIds::SQL, "sql fast parse count", 40116, true, true)
+STAT_EVENT_ADD_DEF(SQL_FAST_PARSE_TIME, "sql fast parse time", ObStatClassIds::SQL, "sql fast parse time", 40117, true, true)
+STAT_EVENT_ADD_DEF(SQL_FAST_PARSE_MEMO_HIT, "sql fast parse memo hit", ObStatClassIds::SQL, "sql fast parse memo hit", 40118, true, true)
 // CACHE
 STAT_EVENT_ADD_DEF(ROW_CACHE_HIT, "row cache hit", ObStatClassIds::CACHE, "row cache hit", 50000, true, true)
 STAT_EVENT_ADD_DEF(ROW_CACHE_MISS, "row cache miss", ObStatClassIds::CACHE, "row cache miss", 50001, true, true)
@@ -49,6 +49,7 @@ Worker::Worker()
       curr_request_level_(0),
       group_id_(0),
       rpc_stat_srv_(nullptr),
+      blocking_ts_(0),
       st_current_priority_(0),
       session_(nullptr),
       timeout_ts_(INT64_MAX),
@@ -90,12 +91,14 @@ Worker::Status Worker::check_wait()
 
 bool Worker::sched_wait()
 {
+  ATOMIC_STORE(&blocking_ts_, ObTimeUtility::current_time());
   return true;
 }
 
 bool Worker::sched_run(int64_t waittime)
 {
   UNUSED(waittime);
+  ATOMIC_STORE(&blocking_ts_, 0);
   check_status();
   return true;
 }
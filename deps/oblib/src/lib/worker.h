@@ -60,6 +60,11 @@ public:
   //   2. false  the worker hasn't right to go ahead
   bool sched_run(int64_t waittime=0);
 
+  // Timestamp the worker began to wait between sched_wait() and
+  // sched_run(), 0 if it isn't waiting. Read by the tenant to tell
+  // workers blocked on sync rpc or transaction waits from busy ones.
+  int64_t get_blocking_ts() const { return ATOMIC_LOAD(&blocking_ts_); }
+
   ObIAllocator &get_sql_arena_allocator() ;
   ObIAllocator &get_allocator() ;
 
@@ -170,6 +175,7 @@ private:
   int32_t curr_request_level_;
   int32_t group_id_;
   void *rpc_stat_srv_;
+  int64_t blocking_ts_;
 
 protected:
   int64_t st_current_priority_;
@@ -347,20 +347,26 @@ int ObMySQLUtil::int_cell_str(
   } else if (OB_UNLIKELY((len - pos) < (OB_LTOA10_CHAR_LEN + 9))) {
     ret = OB_SIZE_OVERFLOW;
   } else {
-    if (TEXT == type) {
-//      char tmp_buff[OB_LTOA10_CHAR_LEN];
-//      int64_t len_raw = ltoa10(static_cast<int64_t>(val), tmp_buff, is_unsigned ? false : true) - tmp_buff;
+    if (TEXT == type && !zerofill) {
+      // at most 20 digits and a sign, the length always fits in one byte,
+      // so format the digits right behind it in the packet buffer.
+      char *digits = buf + pos + 1;
+      const int64_t length = is_unsigned
+          ? ObFastFormatInt::format_unsigned(static_cast<uint64_t>(val), digits)
+          : ObFastFormatInt::format_signed(val, digits);
+      buf[pos] = static_cast<char>(length);
+      pos += 1 + length;
+    } else if (TEXT == type) {
       uint64_t length = 0;
       int64_t zero_cnt = 0;
       ObFastFormatInt ffi(val, is_unsigned);
-      if (zerofill && (zero_cnt = zflength - ffi.length()) > 0) {
+      if ((zero_cnt = zflength - ffi.length()) > 0) {
         length = zflength;
       } else {
         length = static_cast<uint64_t>(ffi.length());
       }
       /* skip bytes_to_store_len bytes to store length */
       int64_t bytes_to_store_len = get_number_store_len(length);
-      MEMCPY(buf + pos + bytes_to_store_len, ffi.ptr(), ffi.length());
       if (zero_cnt > 0) {
         /*zero_cnt > 0 indicates that zerofill is true */
         MEMSET(buf + pos + bytes_to_store_len, '0', zero_cnt);
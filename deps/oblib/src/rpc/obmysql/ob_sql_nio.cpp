@@ -549,7 +549,13 @@ private:
 class ObSqlNioImpl
 {
 public:
-  ObSqlNioImpl(ObISqlSockHandler& handler): handler_(handler), epfd_(-1), lfd_(-1) {}
+  // the listen fd is level triggered, the connections left are accepted in the next round
+  static const int64_t MAX_ACCEPT_PER_ROUND = 128;
+  static const int64_t STAT_INTERVAL = 10L * 1000L * 1000L; // 10s
+  ObSqlNioImpl(ObISqlSockHandler& handler):
+      handler_(handler), epfd_(-1), lfd_(-1),
+      accept_cnt_(0), accept_fail_cnt_(0), accept_time_(0), max_accept_time_(0),
+      last_accept_cnt_(0), last_stat_ts_(0) {}
   ~ObSqlNioImpl() {}
   int init(int port) {
     int ret = OB_SUCCESS;
@@ -582,6 +588,7 @@ public:
     handle_close_req_queue();
     handle_pending_destroy_list();
     print_session_info();
+    print_accept_stat();
   }
   void push_close_req(ObSqlSock* s) {
     if (s->set_error(EIO)) {
@@ -732,7 +739,7 @@ private:
   }
 
   void do_accept_loop() {
-    while(1){
+    for(int64_t i = 0; i < MAX_ACCEPT_PER_ROUND; i++) {
       int fd = -1;
       if ((fd = accept4(lfd_, NULL, NULL, SOCK_NONBLOCK|SOCK_CLOEXEC)) < 0) {
         if (EAGAIN == errno || EWOULDBLOCK == errno) {
@@ -743,10 +750,16 @@ private:
         }
       } else {
         int err = 0;
+        const int64_t begin_ts = ObTimeUtility::current_time();
         if (0 != (err = do_accept_one(fd))) {
           LOG_ERROR("do_accept_one fail", K(fd), K(err));
           close(fd);
+          accept_fail_cnt_++;
         }
+        const int64_t cost_time = ObTimeUtility::current_time() - begin_ts;
+        accept_cnt_++;
+        accept_time_ += cost_time;
+        max_accept_time_ = MAX(max_accept_time_, cost_time);
       }
     }
   }
@@ -809,6 +822,27 @@ private:
       }
     }
   }
+  // connect rate and the time to set up a connection, including the handshake packet,
+  // of this thread since the last print.
+  void print_accept_stat() {
+    const int64_t cur_ts = ObTimeUtility::current_time();
+    if (0 == last_stat_ts_) {
+      last_stat_ts_ = cur_ts;
+    } else if (cur_ts - last_stat_ts_ >= STAT_INTERVAL) {
+      const int64_t accept_cnt = accept_cnt_ - last_accept_cnt_;
+      if (accept_cnt > 0) {
+        const int64_t connect_rate = accept_cnt * 1000000 / (cur_ts - last_stat_ts_);
+        const int64_t avg_accept_time = accept_time_ / accept_cnt;
+        LOG_INFO("[sql nio accept stat]", K_(lfd), K(accept_cnt), K(connect_rate),
+                 K(avg_accept_time), K_(max_accept_time), K_(accept_fail_cnt));
+      }
+      last_accept_cnt_ = accept_cnt_;
+      last_stat_ts_ = cur_ts;
+      accept_time_ = 0;
+      max_accept_time_ = 0;
+      accept_fail_cnt_ = 0;
+    }
+  }
   static void* direct_alloc(int64_t sz) { return common::ob_malloc(sz, common::ObModIds::OB_COMMON_NETWORK); }
   static void direct_free(void* p) { common::ob_free(p); }
 
@@ -821,6 +855,12 @@ private:
   ObSpScLinkQueue write_req_queue_;
   ObDList pending_destroy_list_;
   ObDList all_list_;
+  int64_t accept_cnt_;
+  int64_t accept_fail_cnt_;
+  int64_t accept_time_;
+  int64_t max_accept_time_;
+  int64_t last_accept_cnt_;
+  int64_t last_stat_ts_;
 };
 
 int ObSqlNio::start(int port, ObISqlSockHandler* handler, int n_thread)
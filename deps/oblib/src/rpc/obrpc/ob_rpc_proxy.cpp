@@ -350,6 +350,31 @@ int64_t ObRpcProxy::calc_payload_size(int64_t user_payload)
   return payload;
 }
 
+int64_t ObRpcProxy::compress_skip_cnts_[ObRpcPacketSet::THE_PCODE_COUNT] = {};
+
+bool ObRpcProxy::need_compress(const ObRpcPacketCode pcode, const int64_t original_len)
+{
+  bool bret = false;
+  const int64_t idx = ObRpcPacketSet::instance().idx_of_pcode(pcode);
+  if (original_len < MIN_COMPRESS_SIZE) {
+    // too small to shrink
+  } else if (ATOMIC_LOAD(&compress_skip_cnts_[idx]) > 0
+             && ATOMIC_SAF(&compress_skip_cnts_[idx], 1) >= 0) {
+    // the recent packets of this pcode are incompressible
+  } else {
+    bret = true;
+  }
+  return bret;
+}
+
+void ObRpcProxy::on_compressed(const ObRpcPacketCode pcode, const bool is_shrunk)
+{
+  if (!is_shrunk) {
+    const int64_t idx = ObRpcPacketSet::instance().idx_of_pcode(pcode);
+    ATOMIC_STORE(&compress_skip_cnts_[idx], COMPRESS_SKIP_CNT);
+  }
+}
+
 int ObRpcProxy::fill_extra_payload(
     ObReqTransport::Request &req, int64_t len, int64_t &pos)
 {
@@ -171,6 +171,11 @@ public:
   int fill_extra_payload(
       rpc::frame::ObReqTransport::Request &req, int64_t len, int64_t &pos);
 
+  // Small packets and packets of a pcode which recently did not shrink by compression
+  // are sent without compression, the cpu of compressing them is wasted.
+  static bool need_compress(const ObRpcPacketCode pcode, const int64_t original_len);
+  static void on_compressed(const ObRpcPacketCode pcode, const bool is_shrunk);
+
 
   //// example:
   //// without argument and result
@@ -233,6 +238,11 @@ protected:
                const ObRpcOpts &opts);
 
 private:
+  static const int64_t MIN_COMPRESS_SIZE = 1024;
+  // packets of the pcode skipped after a packet not shrunk by compression
+  static const int64_t COMPRESS_SKIP_CNT = 64;
+  static int64_t compress_skip_cnts_[ObRpcPacketSet::THE_PCODE_COUNT];
+
   int send_request(
       const rpc::frame::ObReqTransport::Request &req,
       rpc::frame::ObReqTransport::Result &result) const;
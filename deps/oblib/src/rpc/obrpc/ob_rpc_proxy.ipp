@@ -619,7 +619,8 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
   int64_t payload = original_len;
   int64_t max_overflow_size = 0;
 
-  bool need_compressed = ObCompressorPool::get_instance().need_common_compress(compressor_type_);
+  bool need_compressed = ObCompressorPool::get_instance().need_common_compress(compressor_type_)
+      && need_compress(pcodeStruct::PCODE, original_len);
   char *serialize_buf = NULL;
   common::ObCompressor *compressor = NULL;
   bool use_context = false;
@@ -711,6 +712,7 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
         EVENT_ADD(RPC_COMPRESS_COMPRESSED_SIZE, original_len);
       } else if (dst_data_size >= original_len) {
         need_compressed = false;
+        on_compressed(pcodeStruct::PCODE, false);
         EVENT_ADD(RPC_COMPRESS_COMPRESSED_SIZE, original_len);
       } else {
         req.pkt_->set_content(req.buf(), dst_data_size);
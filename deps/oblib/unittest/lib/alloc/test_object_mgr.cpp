@@ -92,6 +92,78 @@ TEST_F(TestObjectMgr, Basic2)
   }, 4).start();
 }
 
+TEST_F(TestObjectMgr, DISABLED_ParallelAllocPerf)
+{
+  const int64_t loop_cnt = 1L << 12;
+  for (int thread_cnt = 1; thread_cnt <= 128; thread_cnt *= 2) {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    cotesting::FlexPool([loop_cnt] {
+      void *p[16] = {};
+      for (int64_t cnt = 0; cnt < loop_cnt; cnt++) {
+        for (int i = 0; i < 16; i++) {
+          p[i] = ob_malloc(16 << (i & 7), "PerfTest");
+          ASSERT_TRUE(NULL != p[i]);
+        }
+        for (int i = 0; i < 16; i++) {
+          ob_free(p[i]);
+        }
+      }
+    }, thread_cnt).start();
+    const int64_t cost_ts = ObTimeUtility::current_time() - start_ts;
+    cout << "thread_cnt=" << thread_cnt << " cost_us=" << cost_ts
+         << " ns_per_alloc=" << cost_ts * 1000 / (loop_cnt * 16) << endl;
+  }
+}
+
+TEST_F(TestObjectMgr, ParallelAlloc)
+{
+  ObMallocAllocator *malloc_allocator = ObMallocAllocator::get_instance();
+  const uint64_t tenant_id = 1001;
+  ASSERT_EQ(OB_SUCCESS, malloc_allocator->create_tenant_ctx_allocator(tenant_id, 0));
+  ASSERT_EQ(OB_SUCCESS, malloc_allocator->set_tenant_limit(tenant_id, 1L << 30));
+  ObTenantCtxAllocator *ta = malloc_allocator->get_tenant_ctx_allocator(tenant_id, 0);
+  ASSERT_TRUE(NULL != ta);
+  const int64_t used_before = ta->get_used();
+  const int thread_cnt = 32;
+  const int64_t loop_cnt = 1L << 10;
+  int64_t thread_idx = 0;
+  int64_t fail_cnt = 0;
+  int64_t corrupt_cnt = 0;
+  cotesting::FlexPool([&] {
+    const char pattern = static_cast<char>(ATOMIC_FAA(&thread_idx, 1) + 1);
+    ObMemAttr attr(tenant_id, "ParallelTest");
+    void *p[16] = {};
+    for (int64_t cnt = 0; cnt < loop_cnt; cnt++) {
+      for (int i = 0; i < 16; i++) {
+        const int64_t size = 16 << (i & 7);
+        if (NULL == (p[i] = ob_malloc(size, attr))) {
+          ATOMIC_INC(&fail_cnt);
+        } else {
+          memset(p[i], pattern, size);
+        }
+      }
+      // an object handed out to two threads at the same time is overwritten by the other one
+      for (int i = 0; i < 16; i++) {
+        if (NULL != p[i]) {
+          const int64_t size = 16 << (i & 7);
+          for (int64_t j = 0; j < size; j++) {
+            if (static_cast<char *>(p[i])[j] != pattern) {
+              ATOMIC_INC(&corrupt_cnt);
+              break;
+            }
+          }
+          ob_free(p[i]);
+        }
+      }
+    }
+  }, thread_cnt).start();
+  ASSERT_EQ(thread_cnt, thread_idx);
+  ASSERT_EQ(0, fail_cnt);
+  ASSERT_EQ(0, corrupt_cnt);
+  // every object is freed to the sub mgr it is allocated from
+  ASSERT_EQ(used_before, ta->get_used());
+}
+
 TEST_F(TestObjectMgr, TestName)
 {
   void *p[128];
@@ -214,6 +214,29 @@ TEST_F(TestCharset, hash_sort)
   ASSERT_EQ(ret2, ret3);
 }
 
+TEST_F(TestCharset, ascii_fast_path)
+{
+  // equal ascii words are skipped, the rest is compared by character
+  const char *a = "order_status_pending_a";
+  const char *b = "order_status_pending_B";
+  const char *c = "ORDER_STATUS_PENDING_A";
+  // non ascii character after the equal words
+  const char *d = "order_status_\xc3\xa9";
+  const char *e = "order_status_\xc3\x89";
+  const char *f = "order_status_f";
+  ASSERT_EQ(-1, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), b, strlen(b)));
+  ASSERT_EQ(1, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), a, strlen(a)));
+  ASSERT_EQ(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), c, strlen(c)));
+  ASSERT_EQ(0, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, d, strlen(d), e, strlen(e)));
+  ASSERT_EQ(-1, ObCharset::strcmp(CS_TYPE_UTF8MB4_GENERAL_CI, d, strlen(d), f, strlen(f)));
+  ASSERT_EQ(ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), 0),
+            ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, c, strlen(c), 0));
+  ASSERT_EQ(ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, d, strlen(d), 0),
+            ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, e, strlen(e), 0));
+  ASSERT_NE(ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, a, strlen(a), 0),
+            ObCharset::hash(CS_TYPE_UTF8MB4_GENERAL_CI, b, strlen(b), 0));
+}
+
 TEST_F(TestCharset, case_mode_equal)
 {
   ObString y1= "Variable_name";
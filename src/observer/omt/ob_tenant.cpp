@@ -333,6 +333,7 @@ void ObResourceGroup::calibrate_token_count()
       // do nothing
     } else {
       int64_t wait_worker = 0;
+      int64_t blocking_worker = 0;
       int64_t active_workers = 0;
       DLIST_FOREACH_REMOVESAFE(wnode, workers_) {
         const auto w = static_cast<ObThWorker*>(wnode->get_data());
@@ -340,6 +341,8 @@ void ObResourceGroup::calibrate_token_count()
           active_workers++;
           if (!w->has_req_flag()) {
             wait_worker++;
+          } else if (ObTenant::is_blocking_worker(w->get_blocking_ts(), current_time)) {
+            blocking_worker++;
           }
         }
       }
@@ -347,7 +350,11 @@ void ObResourceGroup::calibrate_token_count()
         set_token_cnt(static_cast<int64_t>(ceil(tenant_->unit_min_cpu())));
         set_min_token_cnt(token_cnt_);
       }
-      if (last_pop_req_cnt_ != 0 && pop_req_cnt_ == last_pop_req_cnt_
+      int64_t token_cnt = token_cnt_;
+      if (ObTenant::raise_token_for_blocking(blocking_worker, active_workers, req_queue_.size(),
+                                             max_token_cnt_, token_cnt)) {
+        set_token_cnt(token_cnt);
+      } else if (last_pop_req_cnt_ != 0 && pop_req_cnt_ == last_pop_req_cnt_
           && token_cnt_ == ass_token_cnt_) {
         set_token_cnt(min(token_cnt_ + 1, max_token_cnt_));
       }
@@ -1347,6 +1354,7 @@ void ObTenant::calibrate_token_count()
     if (current_time - last_calibrate_token_ts_ > CALIBRATE_TOKEN_INTERVAL &&
           OB_SUCC(workers_lock_.trylock())) {
       int64_t wait_worker = 0;
+      int64_t blocking_worker = 0;
       int64_t active_workers = 0;
       DLIST_FOREACH_REMOVESAFE(wnode, workers_) {
         const auto w = static_cast<ObThWorker*>(wnode->get_data());
@@ -1354,10 +1362,16 @@ void ObTenant::calibrate_token_count()
           active_workers++;
           if (!w->has_req_flag()) {
             wait_worker++;
+          } else if (ObTenant::is_blocking_worker(w->get_blocking_ts(), current_time)) {
+            blocking_worker++;
           }
         }
       }
-      if (last_pop_normal_cnt_ != 0 && pop_normal_cnt_ == last_pop_normal_cnt_) {
+      int64_t token_cnt = token_cnt_;
+      if (raise_token_for_blocking(blocking_worker, active_workers, req_queue_.size(),
+                                   worker_count_bound(), token_cnt)) {
+        set_token(token_cnt);
+      } else if (last_pop_normal_cnt_ != 0 && pop_normal_cnt_ == last_pop_normal_cnt_) {
         set_token(min(token_cnt_ + 1, worker_count_bound()));
       }
       if (wait_worker > active_workers / 2) {
@@ -1370,6 +1384,27 @@ void ObTenant::calibrate_token_count()
   }
 }
 
+bool ObTenant::is_blocking_worker(const int64_t blocking_ts, const int64_t current_time)
+{
+  return blocking_ts > 0 && current_time - blocking_ts > BLOCKING_WORKER_THRESHOLD;
+}
+
+bool ObTenant::raise_token_for_blocking(const int64_t blocking_worker,
+                                        const int64_t active_workers,
+                                        const int64_t queued_req_cnt,
+                                        const int64_t max_token_cnt,
+                                        int64_t &token_cnt)
+{
+  bool bret = false;
+  if (blocking_worker > active_workers / 2 && queued_req_cnt > 0) {
+    // most workers wait on sync rpc, transaction results or the like, let
+    // more workers serve the queued requests instead of waiting for them
+    token_cnt = min(token_cnt + blocking_worker - active_workers / 2, max_token_cnt);
+    bret = true;
+  }
+  return bret;
+}
+
 void ObTenant::calibrate_group_token_count()
 {
   if (dynamic_modify_group_token_) {
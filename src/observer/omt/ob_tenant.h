@@ -559,6 +559,21 @@ public:
   // calling this function.
   void periodically_check();
 
+  // Token calibration rules for blocked workers, shared by the tenant and
+  // its resource groups. A worker waiting longer than the threshold between
+  // sched_wait() and sched_run(), e.g. on a sync rpc or a transaction
+  // result, is blocked.
+  static constexpr int64_t BLOCKING_WORKER_THRESHOLD = 10 * 1000L;
+  static bool is_blocking_worker(const int64_t blocking_ts, const int64_t current_time);
+  // More than half of the active workers are blocked and requests are
+  // queued: add the excess blocked workers to TOKEN_CNT, bounded by
+  // MAX_TOKEN_CNT. Return false and leave TOKEN_CNT alone otherwise.
+  static bool raise_token_for_blocking(const int64_t blocking_worker,
+                                       const int64_t active_workers,
+                                       const int64_t queued_req_cnt,
+                                       const int64_t max_token_cnt,
+                                       int64_t &token_cnt);
+
 private:
   // alloc NUM worker
   int acquire_level_worker(int64_t num, int64_t &succ_num, int32_t level);
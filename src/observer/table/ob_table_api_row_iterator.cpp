@@ -196,7 +196,8 @@ int ObTableApiRowIterator::fill_multi_get_param(
     ObTableServiceCtx &ctx,
     const ObTableBatchOperation &batch_operation,
     storage::ObTableScanParam &scan_param,
-    share::schema::ObTableParam &table_param)
+    share::schema::ObTableParam &table_param,
+    const ObIArray<int64_t> *get_order)
 {
   int ret = OB_SUCCESS;
   scan_param.key_ranges_.reset();
@@ -204,10 +205,14 @@ int ObTableApiRowIterator::fill_multi_get_param(
   if (N <= 0) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument, ", K(ret), K(N));
+  } else if (NULL != get_order && N != get_order->count()) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid get order, ", K(ret), K(N), "order_cnt", get_order->count());
   }
 
   for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
-    ObRowkey rowkey = const_cast<ObITableEntity &>(batch_operation.at(i).entity()).get_rowkey();
+    const int64_t idx = NULL == get_order ? i : get_order->at(i);
+    ObRowkey rowkey = const_cast<ObITableEntity &>(batch_operation.at(idx).entity()).get_rowkey();
     if (OB_FAIL(fill_range(rowkey, scan_param.key_ranges_))) {
       LOG_WARN("Fail to fill range, ", K(ret), K(i));
     }
@@ -1469,7 +1474,8 @@ ObTableApiMultiGetRowIterator::~ObTableApiMultiGetRowIterator()
 {
 }
 
-int ObTableApiMultiGetRowIterator::open(const ObTableBatchOperation &batch_operation)
+int ObTableApiMultiGetRowIterator::open(const ObTableBatchOperation &batch_operation,
+                                        const ObIArray<int64_t> &get_order)
 {
   int ret = OB_SUCCESS;
   const bool ignore_missing_column = true;
@@ -1478,7 +1484,8 @@ int ObTableApiMultiGetRowIterator::open(const ObTableBatchOperation &batch_opera
     LOG_WARN("The table api multi get row iterator has not been inited, ", K(ret));
   } else if (OB_FAIL(cons_all_columns(batch_operation.at(0).entity(), ignore_missing_column))) {
     LOG_WARN("Fail to construct all columns, ", K(ret));
-  } else if (OB_FAIL(fill_multi_get_param(*ctx_, batch_operation, scan_param_, table_param_))) {
+  } else if (OB_FAIL(fill_multi_get_param(*ctx_, batch_operation, scan_param_, table_param_,
+                                          &get_order))) {
     LOG_WARN("Fail to fill get param, ", K(ret));
   } else if (OB_FAIL(access_service_->table_scan(scan_param_, scan_iter_))) {
     if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
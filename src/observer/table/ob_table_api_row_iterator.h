@@ -48,11 +48,14 @@ protected:
       ObRowkey &rowkey,
       storage::ObTableScanParam &scan_param,
       share::schema::ObTableParam &table_param);
+  // %get_order is the order in which the rowkeys of %batch_operation are read,
+  // the order of %batch_operation is used if it is NULL.
   int fill_multi_get_param(
       ObTableServiceCtx &ctx,
       const ObTableBatchOperation &batch_operation,
       storage::ObTableScanParam &scan_param,
-      share::schema::ObTableParam &table_param);
+      share::schema::ObTableParam &table_param,
+      const common::ObIArray<int64_t> *get_order = NULL);
   int fill_generate_columns(common::ObNewRow &row);
   virtual bool is_read() const { return false; }
 private:
@@ -251,7 +254,9 @@ class ObTableApiMultiGetRowIterator : public ObTableApiGetRowIterator
 public:
   ObTableApiMultiGetRowIterator();
   virtual ~ObTableApiMultiGetRowIterator();
-  int open(const ObTableBatchOperation &table_operation);
+  // rows are returned in the order of %get_order
+  int open(const ObTableBatchOperation &table_operation,
+           const common::ObIArray<int64_t> &get_order);
 };
 
 
@@ -25,6 +25,7 @@
 #include "share/schema/ob_schema_mgr.h"
 #include "ob_table_rpc_processor_util.h"
 #include "observer/mysql/ob_mysql_request_manager.h"
+#include "observer/mysql/obmp_base.h"
 #include "share/ob_define.h"
 #include "storage/tx/ob_trans_service.h"
 
@@ -747,6 +748,10 @@ int ObTableApiProcessorBase::process_with_retry(const ObString &credential, cons
     ObMaxWaitGuard max_wait_guard(&audit_record_.exec_record_.max_wait_event_);
     ObTotalWaitGuard total_wait_guard(&total_wait_desc);
     ObTenantStatEstGuard stat_guard(credential_.tenant_id_);
+    // peak memory of the request, shown as request_memory_used in sql audit
+    audit_record_.request_memory_used_ = 0;
+    ObProcessMallocCallback pmcb(0, audit_record_.request_memory_used_);
+    lib::ObMallocCallbackGuard malloc_guard(pmcb);
     need_retry_in_queue_ = false;
     bool did_local_retry = false;
     do {
@@ -620,9 +620,86 @@ int ObTableService::execute_get(ObTableServiceGetCtx &ctx, const ObTableOperatio
   return ret;
 }
 
+namespace
+{
+class MultiGetKeyComparator
+{
+public:
+  explicit MultiGetKeyComparator(const ObTableBatchOperation &batch_operation)
+      : batch_operation_(batch_operation)
+  {}
+  // only called on the keys checked by are_multi_get_keys_comparable()
+  bool operator()(const int64_t lhs, const int64_t rhs) const
+  {
+    int ret = OB_SUCCESS;
+    int cmp = 0;
+    ObRowkey lhs_key = const_cast<ObITableEntity &>(batch_operation_.at(lhs).entity()).get_rowkey();
+    ObRowkey rhs_key = const_cast<ObITableEntity &>(batch_operation_.at(rhs).entity()).get_rowkey();
+    if (OB_FAIL(lhs_key.compare(rhs_key, cmp))) {
+      LOG_ERROR("failed to compare checked rowkey", K(ret), K(lhs_key), K(rhs_key));
+    }
+    return cmp < 0 || (0 == cmp && lhs < rhs);
+  }
+private:
+  const ObTableBatchOperation &batch_operation_;
+};
+
+// The rowkeys come from the client and may fail to compare with each other,
+// which breaks the strict weak ordering std::sort relies on. They are sorted
+// only if the non-null objects of each column have the same type and collation,
+// so that any two of them compare successfully.
+bool are_multi_get_keys_comparable(const ObTableBatchOperation &batch_operation)
+{
+  bool bret = true;
+  const int64_t N = batch_operation.count();
+  int64_t max_obj_cnt = 0;
+  for (int64_t i = 0; i < N; ++i) {
+    max_obj_cnt = std::max(max_obj_cnt, batch_operation.at(i).entity().get_rowkey_size());
+  }
+  for (int64_t col = 0; bret && col < max_obj_cnt; ++col) {
+    const ObObj *first_obj = NULL;
+    for (int64_t i = 0; bret && i < N; ++i) {
+      ObRowkey key = const_cast<ObITableEntity &>(batch_operation.at(i).entity()).get_rowkey();
+      if (col < key.get_obj_cnt() && !key.get_obj_ptr()[col].is_null()) {
+        const ObObj &obj = key.get_obj_ptr()[col];
+        if (NULL == first_obj) {
+          first_obj = &obj;
+        } else if (obj.get_type() != first_obj->get_type()
+                   || obj.get_collation_type() != first_obj->get_collation_type()) {
+          bret = false;
+        }
+      }
+    }
+  }
+  return bret;
+}
+} // end anonymous namespace
+
+// Read the rowkeys of a multi-get in rowkey order, so that the gets of the same
+// micro block are adjacent and the prefetched blocks are reused by the following
+// keys. The original order is used if the rowkeys are not comparable.
+int ObTableService::sort_multi_get_keys(const ObTableBatchOperation &batch_operation,
+                                        ObIArray<int64_t> &get_order)
+{
+  int ret = OB_SUCCESS;
+  const int64_t N = batch_operation.count();
+  get_order.reuse();
+  for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
+    if (OB_FAIL(get_order.push_back(i))) {
+      LOG_WARN("failed to push back", K(ret), K(i));
+    }
+  }
+  if (OB_SUCC(ret) && N > 1 && are_multi_get_keys_comparable(batch_operation)) {
+    int64_t *begin = &get_order.at(0);
+    std::sort(begin, begin + N, MultiGetKeyComparator(batch_operation));
+  }
+  return ret;
+}
+
 int ObTableService::fill_multi_get_result(
     ObTableServiceGetCtx &ctx,
     const ObTableBatchOperation &batch_operation,
+    const ObIArray<int64_t> &get_order,
     ObTableApiRowIterator *scan_result,
     ObTableBatchOperationResult &result)
 {
@@ -630,12 +707,21 @@ int ObTableService::fill_multi_get_result(
   const int64_t rowkey_size = batch_operation.at(0).entity().get_rowkey_size();
   ObNewRow *row = NULL;
   const int64_t N = batch_operation.count();
+  const int64_t base_idx = result.count();
   bool did_get_next_row = true;
+  // rows are scanned in %get_order, results are placed in the order of the batch
+  if (OB_UNLIKELY(N != get_order.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid get order", K(ret), K(N), "order_cnt", get_order.count());
+  } else if (OB_FAIL(result.prepare_allocate(base_idx + N))) {
+    LOG_WARN("failed to prepare allocate result", K(ret), K(base_idx), K(N));
+  }
   for (int64_t i = 0; OB_SUCCESS == ret && i < N; ++i) {
     // left join
-    const ObTableEntity &entity = static_cast<const ObTableEntity&>(batch_operation.at(i).entity());
+    const int64_t idx = get_order.at(i);
+    const ObTableEntity &entity = static_cast<const ObTableEntity&>(batch_operation.at(idx).entity());
     ObRowkey expected_key = const_cast<ObTableEntity&>(entity).get_rowkey();
-    ObTableOperationResult op_result;
+    ObTableOperationResult &op_result = result.at(base_idx + idx);
     ObITableEntity *result_entity = result.get_entity_factory()->alloc();
     if (NULL == result_entity) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -647,12 +733,9 @@ int ObTableService::fill_multi_get_result(
     if (did_get_next_row) {
       if (OB_FAIL(scan_result->get_next_row(row))) {
         if (OB_ITER_END == ret) {
-          // push empty entity
+          // empty entity
           ret = OB_SUCCESS;
           op_result.set_errno(OB_SUCCESS);
-          if (OB_FAIL(result.push_back(op_result))) {
-            LOG_WARN("failed to push back result", K(ret), K(i));
-          }
           continue;
         } else {
           LOG_WARN("failed to get next row", K(ret));
@@ -684,11 +767,6 @@ int ObTableService::fill_multi_get_result(
       }
       op_result.set_errno(OB_SUCCESS);
     }
-    if (OB_SUCC(ret)) {
-      if (OB_FAIL(result.push_back(op_result))) {
-        LOG_WARN("failed to push back result", K(ret), K(i));
-      }
-    }
   }  // end for
   return ret;
 }
@@ -696,13 +774,16 @@ int ObTableService::fill_multi_get_result(
 int ObTableService::multi_get(ObTableServiceGetCtx &ctx, const ObTableBatchOperation &batch_operation, ObTableBatchOperationResult &result)
 {
   int ret = OB_SUCCESS;
+  ObSEArray<int64_t, ObTableBatchOperation::COMMON_BATCH_SIZE> get_order;
   SMART_VAR(ObTableApiMultiGetRowIterator, multi_get_iter) {
     ObAccessService *access_service = MTL(ObAccessService *);
-    if (OB_FAIL(multi_get_iter.init(*access_service, *schema_service_, ctx))) {
+    if (OB_FAIL(sort_multi_get_keys(batch_operation, get_order))) {
+      LOG_WARN("failed to sort multi get keys", K(ret));
+    } else if (OB_FAIL(multi_get_iter.init(*access_service, *schema_service_, ctx))) {
       LOG_WARN("Fail to init multi get iter, ", K(ret));
-    } else if (OB_FAIL(multi_get_iter.open(batch_operation))) {
+    } else if (OB_FAIL(multi_get_iter.open(batch_operation, get_order))) {
       LOG_WARN("Fail to open multi get iter, ", K(ret));
-    } else if (OB_FAIL(fill_multi_get_result(ctx, batch_operation, &multi_get_iter, result))) {
+    } else if (OB_FAIL(fill_multi_get_result(ctx, batch_operation, get_order, &multi_get_iter, result))) {
       LOG_WARN("failed to send result");
     }
   }
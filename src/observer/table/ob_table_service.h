@@ -260,9 +260,12 @@ private:
       ObTableApiRowIterator *scan_result,
       ObTableOperationResult &operation_result);
   // for multi-get
+  static int sort_multi_get_keys(const ObTableBatchOperation &batch_operation,
+                                 common::ObIArray<int64_t> &get_order);
   int fill_multi_get_result(
       ObTableServiceGetCtx &ctx,
       const ObTableBatchOperation &batch_operation,
+      const common::ObIArray<int64_t> &get_order,
       ObTableApiRowIterator *scan_result,
       ObTableBatchOperationResult &result);
   int delete_can_use_put(table::ObTableEntityType entity_type, uint64_t table_id, bool &use_put);
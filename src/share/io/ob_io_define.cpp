@@ -828,6 +828,11 @@ bool ObIOHandle::is_empty() const
   return nullptr == req_;
 }
 
+bool ObIOHandle::is_finished() const
+{
+  return nullptr != req_ && req_->is_finished_;
+}
+
 bool ObIOHandle::is_valid() const
 {
   return nullptr != req_;
@@ -299,6 +299,7 @@ public:
   int set_request(ObIORequest &req);
   bool is_empty() const;
   bool is_valid() const;
+  bool is_finished() const;
 
   int wait(const int64_t timeout_ms);
   const char *get_buffer();
@@ -118,4 +118,5 @@ TG_DEF(DDLScanTask, DDLScanTask, "", TG_STATIC, TIMER)
 TG_DEF(TenantLSMetaChecker, LSMetaCh, "", TG_STATIC, TIMER)
 TG_DEF(TenantTabletMetaChecker, TbMetaCh, "", TG_STATIC, TIMER)
 TG_DEF(ServerMetaChecker, SvrMetaCh, "", TG_STATIC, TIMER)
+TG_DEF(MicroBlockCompress, MicroCompress, "", TG_DYNAMIC, QUEUE_THREAD, ThreadCountPair(1, 1), 10000)
 #endif
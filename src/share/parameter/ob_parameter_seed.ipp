@@ -788,6 +788,18 @@ DEF_INT(_fast_commit_callback_count, OB_CLUSTER_PARAMETER, "10000", "[0,)"
 DEF_INT(_minor_compaction_amplification_factor, OB_TENANT_PARAMETER, "0", "[0,100]",
         "thre L1 compaction write amplification factor, 0 means default 25, Range: [0,100] in integer",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_minor_compaction_tier_width, OB_TENANT_PARAMETER, "0", "[0,16]",
+        "the number of sstables with similar size merged together by the size tiered minor compaction, "
+        "0 means the leveled minor compaction driven by minor_compact_trigger, Range: [0,16] in integer",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_minor_compaction_max_read_amplification, OB_TENANT_PARAMETER, "16", "[2,32]",
+        "the max count of minor sstables read by a point get allowed by the size tiered minor compaction, "
+        "all the minor sstables are merged when exceeded, Range: [2,32] in integer",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_micro_block_compress_thread_count, OB_TENANT_PARAMETER, "0", "[0,64]",
+        "the number of threads per tenant compressing the micro blocks of compaction in background, "
+        "0 means compressing in the merge threads. Range: [0,64] in integer",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(_minor_compaction_interval, OB_TENANT_PARAMETER, "0s", "[0s,30m]",
          "the time interval to start next minor compaction, Range: [0s,30m]"
          "Range: [0s, 30m)",
@@ -802,6 +814,24 @@ DEF_TIME(ob_compaction_schedule_interval, OB_TENANT_PARAMETER, "120s", "[3s,5m]"
 DEF_INT(_ob_elr_fast_freeze_threshold, OB_CLUSTER_PARAMETER, "500000", "[10000,)",
          "per row update counts threshold to trigger minor freeze for tables with ELR optimization",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_minor_micro_block_reuse, OB_TENANT_PARAMETER, "False",
+         "specifies whether the micro blocks are reused when the macro block can not be reused "
+         "as a whole in minor compaction. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_compaction_throttle, OB_TENANT_PARAMETER, "False",
+         "specifies whether the concurrency and the write bandwidth of minor and major compaction "
+         "are adjusted by the io rt and the cpu usage of the tenant. "
+         "Value: True:turned on;  False: turned off",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_compaction_throttle_io_rt_threshold, OB_TENANT_PARAMETER, "10ms", "[100us,10s]",
+         "compaction is throttled when the average rt of the user read io of the tenant exceeds the threshold, "
+         "and speeded up when it is below half of the threshold. Range: [100us,10s]",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_compaction_throttle_cpu_threshold, OB_TENANT_PARAMETER, "80", "[1,100]",
+        "compaction is throttled when the cpu usage of the tenant, in percentage of its unit max cpu, exceeds the threshold, "
+        "and speeded up when it is below half of the threshold. Range: [1,100] in integer",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_ob_enable_fast_freeze, OB_TENANT_PARAMETER, "True",
          "specifies whether the tenant's fast freeze is enabled"
          "Value: True:turned on;  False: turned off",
@@ -1216,6 +1246,9 @@ DEF_BOOL(_enable_trace_session_leak, OB_CLUSTER_PARAMETER, "False",
 DEF_BOOL(_ob_enable_fast_parser, OB_CLUSTER_PARAMETER, "True",
          "control if enable fast parser",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_fast_parse_memo, OB_CLUSTER_PARAMETER, "True",
+         "control if the recent fast parser results of identical sql text are reused by each worker thread",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_TIME(_ob_obj_dep_maint_task_interval, OB_CLUSTER_PARAMETER, "1ms", "[0,10s]",
          "The execution interval of the task of maintaining the dependency of the object. "\
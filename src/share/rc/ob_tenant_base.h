@@ -44,6 +44,7 @@ namespace sql {
 }
 namespace blocksstable {
   class ObSharedMacroBlockMgr;
+  class ObMicroBlockCompressPool;
 }
 namespace storage {
   struct ObTenantStorageInfo;
@@ -197,6 +198,7 @@ namespace detector
       sql::ObDASIDService*,                          \
       share::schema::ObTenantSchemaService*,         \
       blocksstable::ObSharedMacroBlockMgr*,          \
+      blocksstable::ObMicroBlockCompressPool*,       \
       storage::ObTenantFreezer*,                     \
       storage::checkpoint::ObCheckPointService *,    \
       storage::checkpoint::ObTabletGCService *,      \
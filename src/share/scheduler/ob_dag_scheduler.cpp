@@ -1248,6 +1248,9 @@ const char *ObDagSchedulerInfo::ObValueTypeStr[VALUE_TYPE_MAX] =
     "DAG_COUNT",
     "DAG_NET_COUNT",
     "RUNNING_TASK_CNT",
+    "QUEUE_WAIT_TIME",
+    "QUEUE_WAIT_HIST",
+    "DISPATCH_LATENCY",
 };
 
 const char* ObDagSchedulerInfo::get_value_type_str(ObValueType type)
@@ -1286,6 +1289,7 @@ ObTenantDagWorker::ObTenantDagWorker()
     status_(DWS_FREE),
     check_period_(0),
     last_check_time_(0),
+    dispatch_time_(0),
     tg_id_(-1),
     is_inited_(false)
 {
@@ -1345,6 +1349,7 @@ void ObTenantDagWorker::destroy()
     status_ = DWS_FREE;
     check_period_ = 0;
     last_check_time_ = 0;
+    dispatch_time_ = 0;
     self_ = NULL;
     is_inited_ = false;
     TG_DESTROY(tg_id_);
@@ -1384,6 +1389,7 @@ void ObTenantDagWorker::run1()
         ret = OB_ERR_UNEXPECTED;
         COMMON_LOG(WARN, "dag is null", K(ret), K(task_));
       } else {
+        MTL(ObTenantDagScheduler*)->add_dispatch_latency(dag->get_priority(), last_check_time_ - dispatch_time_);
         ObCurTraceId::set(dag->get_dag_id());
         lib::set_thread_name(dag->get_dag_type_str(dag->get_type()));
         if (OB_UNLIKELY(lib::Worker::CompatMode::INVALID == (compat_mode = dag->get_compat_mode()))) {
@@ -1480,6 +1486,7 @@ ObTenantDagScheduler::ObTenantDagScheduler()
     work_thread_num_(0),
     default_work_thread_num_(0),
     total_running_task_cnt_(0),
+    compaction_throttle_percent_(DEFAULT_COMPACTION_THROTTLE_PERCENT),
     tg_id_(-1)
 {
 }
@@ -1551,6 +1558,11 @@ int ObTenantDagScheduler::init(
     allocator_.set_label(ObModIds::OB_SCHEDULER);
     MEMSET(dag_cnts_, 0, sizeof(dag_cnts_));
     MEMSET(dag_net_cnts_, 0, sizeof(dag_net_cnts_));
+    MEMSET(scheduled_dag_cnts_, 0, sizeof(scheduled_dag_cnts_));
+    MEMSET(queue_wait_times_, 0, sizeof(queue_wait_times_));
+    MEMSET(queue_wait_hists_, 0, sizeof(queue_wait_hists_));
+    MEMSET(dispatch_task_cnts_, 0, sizeof(dispatch_task_cnts_));
+    MEMSET(dispatch_latencies_, 0, sizeof(dispatch_latencies_));
     MEMSET(running_task_cnts_, 0, sizeof(running_task_cnts_));
 
     get_default_config();
@@ -1631,9 +1643,15 @@ void ObTenantDagScheduler::destroy()
     total_worker_cnt_ = 0;
     work_thread_num_ = 0;
     total_running_task_cnt_ = 0;
+    compaction_throttle_percent_ = DEFAULT_COMPACTION_THROTTLE_PERCENT;
     MEMSET(running_task_cnts_, 0, sizeof(running_task_cnts_));
     MEMSET(dag_cnts_, 0, sizeof(dag_cnts_));
     MEMSET(dag_net_cnts_, 0, sizeof(dag_net_cnts_));
+    MEMSET(scheduled_dag_cnts_, 0, sizeof(scheduled_dag_cnts_));
+    MEMSET(queue_wait_times_, 0, sizeof(queue_wait_times_));
+    MEMSET(queue_wait_hists_, 0, sizeof(queue_wait_hists_));
+    MEMSET(dispatch_task_cnts_, 0, sizeof(dispatch_task_cnts_));
+    MEMSET(dispatch_latencies_, 0, sizeof(dispatch_latencies_));
     waiting_workers_.reset();
     running_workers_.reset();
     is_inited_ = false;
@@ -1685,6 +1703,7 @@ void ObTenantDagScheduler::get_default_config()
 {
   int64_t threads_sum = 0;
   for (int64_t i = 0; i < ObDagPrio::DAG_PRIO_MAX; ++i) { // calc sum of default_low_limit
+    thread_scores_[i] = OB_DAG_PRIOS[i].score_;
     low_limits_[i] = OB_DAG_PRIOS[i].score_; // temp solution
     up_limits_[i] = OB_DAG_PRIOS[i].score_;
     threads_sum += up_limits_[i];
@@ -1874,6 +1893,16 @@ void ObTenantDagScheduler::dump_dag_status()
 
 }
 
+// upper bounds of the buckets of the queue wait histogram, us
+static const int64_t QUEUE_WAIT_HIST_BUCKET_BOUNDS[ObTenantDagScheduler::QUEUE_WAIT_HIST_BUCKET_CNT] =
+{
+  1000L, 10 * 1000L, 100 * 1000L, 1000 * 1000L, 10 * 1000 * 1000L, 60 * 1000 * 1000L, INT64_MAX
+};
+static const char *QUEUE_WAIT_HIST_BUCKET_STRS[ObTenantDagScheduler::QUEUE_WAIT_HIST_BUCKET_CNT] =
+{
+  "1MS", "10MS", "100MS", "1S", "10S", "60S", "INF"
+};
+
 #define ADD_DAG_SCHEDULER_INFO(value_type, key_str, value) \
   { \
     info_list[idx].tenant_id_ = MTL_ID(); \
@@ -1901,7 +1930,8 @@ int ObTenantDagScheduler::get_all_dag_scheduler_info(
 {
   int ret = OB_SUCCESS;
   int64_t idx = 0;
-  int64_t total_cnt = 3 + 3 * ObDagPrio::DAG_PRIO_MAX + ObDagType::DAG_TYPE_MAX + ObDagNetType::DAG_NET_TYPE_MAX;
+  int64_t total_cnt = 3 + 3 * ObDagPrio::DAG_PRIO_MAX + ObDagType::DAG_TYPE_MAX + ObDagNetType::DAG_NET_TYPE_MAX
+      + ObDagType::DAG_TYPE_MAX + ObDagPrio::DAG_PRIO_MAX * (1 + QUEUE_WAIT_HIST_BUCKET_CNT);
   void *buf = nullptr;
   ObDagSchedulerInfo *info_list = nullptr;
   if (OB_ISNULL(buf = allocator.alloc(sizeof(ObDagSchedulerInfo) * total_cnt))) {
@@ -1926,11 +1956,62 @@ int ObTenantDagScheduler::get_all_dag_scheduler_info(
       for (int64_t i = 0; i < ObDagNetType::DAG_NET_TYPE_MAX; ++i) {
         ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::DAG_NET_COUNT, OB_DAG_NET_TYPES[i].dag_net_type_str_, dag_net_cnts_[i]);
       }
+      if (OB_FAIL(gene_schedule_stat_info(info_list, scheduler_infos, idx))) {
+        COMMON_LOG(WARN, "failed to generate schedule stat info", K(ret));
+      }
     }
   }
   return ret;
 }
 
+int ObTenantDagScheduler::gene_schedule_stat_info(
+    ObDagSchedulerInfo *info_list,
+    common::ObIArray<void *> &scheduler_infos,
+    int64_t &idx)
+{
+  int ret = OB_SUCCESS;
+  char key[OB_DAG_KEY_LENGTH] = "\0";
+  for (int64_t i = 0; i < ObDagType::DAG_TYPE_MAX; ++i) {
+    const int64_t cnt = scheduled_dag_cnts_[i];
+    ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::QUEUE_WAIT_TIME, OB_DAG_TYPES[i].dag_type_str_,
+        0 == cnt ? 0 : queue_wait_times_[i] / cnt);
+  }
+  for (int64_t i = 0; i < ObDagPrio::DAG_PRIO_MAX; ++i) {
+    for (int64_t j = 0; j < QUEUE_WAIT_HIST_BUCKET_CNT; ++j) {
+      snprintf(key, sizeof(key), "%s:%s", OB_DAG_PRIOS[i].dag_prio_str_, QUEUE_WAIT_HIST_BUCKET_STRS[j]);
+      ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::QUEUE_WAIT_HIST, key, queue_wait_hists_[i][j]);
+    }
+    const int64_t cnt = ATOMIC_LOAD(&dispatch_task_cnts_[i]);
+    ADD_DAG_SCHEDULER_INFO(ObDagSchedulerInfo::DISPATCH_LATENCY, OB_DAG_PRIOS[i].dag_prio_str_,
+        0 == cnt ? 0 : ATOMIC_LOAD(&dispatch_latencies_[i]) / cnt);
+  }
+  return ret;
+}
+
+void ObTenantDagScheduler::add_queue_wait_time(const ObIDag &dag)
+{
+  const int64_t type = dag.get_type();
+  const int64_t prio = dag.get_priority();
+  const int64_t wait_time = MAX(0, dag.get_start_time() - dag.get_add_time());
+  if (type >= 0 && type < ObDagType::DAG_TYPE_MAX && prio >= 0 && prio < ObDagPrio::DAG_PRIO_MAX) {
+    int64_t bucket = 0;
+    while (bucket < QUEUE_WAIT_HIST_BUCKET_CNT - 1 && wait_time > QUEUE_WAIT_HIST_BUCKET_BOUNDS[bucket]) {
+      ++bucket;
+    }
+    ++scheduled_dag_cnts_[type];
+    queue_wait_times_[type] += wait_time;
+    ++queue_wait_hists_[prio][bucket];
+  }
+}
+
+void ObTenantDagScheduler::add_dispatch_latency(const int64_t priority, const int64_t latency)
+{
+  if (priority >= 0 && priority < ObDagPrio::DAG_PRIO_MAX) {
+    (void)ATOMIC_AAF(&dispatch_task_cnts_[priority], 1);
+    (void)ATOMIC_AAF(&dispatch_latencies_[priority], MAX(0, latency));
+  }
+}
+
 #define ADD_DAG_INFO(cur, list_info) \
   { \
     cur->gene_dag_info(info_list[idx], list_info); \
@@ -2270,8 +2351,16 @@ int ObTenantDagScheduler::deal_with_finish_task(ObITask &task, ObTenantDagWorker
     --running_task_cnts_[prio];
     --total_running_task_cnt_;
     running_workers_.remove(&worker, prio);
-    free_workers_.add_last(&worker);
+    // the worker picks the next task by itself, avoiding the round trip through the
+    // scheduler thread. The first task scheduled is dispatched to this worker since
+    // it is at the head of the free list.
+    free_workers_.add_first(&worker);
     worker.set_task(NULL);
+    if (!has_set_stop() && OB_TMP_FAIL(loop_ready_dag_lists())) {
+      if (OB_ENTRY_NOT_EXIST != tmp_ret) {
+        COMMON_LOG(WARN, "failed to schedule in worker", K(tmp_ret));
+      }
+    }
     scheduler_sync_.signal();
   }
 
@@ -2698,6 +2787,9 @@ int ObTenantDagScheduler::pop_task_from_ready_list(
         cur->set_dag_status(next_dag_status);
         cur->update_status_in_dag_net();
         cur->start_time_ = ObTimeUtility::current_time(); // dag start running
+        if (ObIDag::DAG_STATUS_READY == dag_status && ObIDag::DAG_STATUS_NODE_RUNNING == next_dag_status) {
+          add_queue_wait_time(*cur);
+        }
         COMMON_LOG(DEBUG, "dag start running", K(ret), KPC(cur));
       } else if (ObIDag::DAG_STATUS_NODE_FAILED == dag_status
           && 0 == cur->get_running_task_count()) { // no task running failed dag, need free
@@ -2732,6 +2824,15 @@ int ObTenantDagScheduler::pop_task_from_ready_list(
         }
       } else {
         task = ready_task;
+        // round robin between the ready dags of the same priority, so that a dag with
+        // lots of tasks can't starve the short dags queued after it
+        if (cur->get_next() != head
+            && (!dag_list_[READY_DAG_LIST].remove(cur, priority)
+                || !dag_list_[READY_DAG_LIST].add_last(cur, priority))) {
+          ret = OB_ERR_UNEXPECTED;
+          COMMON_LOG(ERROR, "failed to move dag to the tail of ready list", K(ret), KPC(cur));
+          ob_abort();
+        }
         break;
       }
     } // end of while
@@ -2972,8 +3073,8 @@ int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int32_t
   } else {
     ObThreadCondGuard guard(scheduler_sync_);
     const int32_t old_val = up_limits_[priority];
-    up_limits_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
-    low_limits_[priority] = up_limits_[priority];
+    thread_scores_[priority] = 0 == score ? OB_DAG_PRIOS[priority].score_ : score;
+    update_limit(priority);
     if (old_val != up_limits_[priority]) {
       update_work_thread_num();
     }
@@ -2985,6 +3086,42 @@ int ObTenantDagScheduler::set_thread_score(const int64_t priority, const int32_t
   return ret;
 }
 
+void ObTenantDagScheduler::update_limit(const int64_t priority)
+{
+  int32_t limit = thread_scores_[priority];
+  // mini merge is never throttled, or the memstore may be exhausted
+  if (ObDagPrio::DAG_PRIO_COMPACTION_MID == priority || ObDagPrio::DAG_PRIO_COMPACTION_LOW == priority) {
+    limit = MAX(1, static_cast<int32_t>(limit * compaction_throttle_percent_ / 100));
+  }
+  up_limits_[priority] = limit;
+  low_limits_[priority] = limit;
+}
+
+int ObTenantDagScheduler::set_compaction_throttle(const int64_t percent)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "ObTenantDagScheduler is not inited", K(ret));
+  } else if (OB_UNLIKELY(percent <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "invalid argument", K(ret), K(percent));
+  } else {
+    ObThreadCondGuard guard(scheduler_sync_);
+    if (percent != compaction_throttle_percent_) {
+      ATOMIC_STORE(&compaction_throttle_percent_, percent);
+      update_limit(ObDagPrio::DAG_PRIO_COMPACTION_MID);
+      update_limit(ObDagPrio::DAG_PRIO_COMPACTION_LOW);
+      update_work_thread_num();
+      scheduler_sync_.signal();
+      COMMON_LOG(INFO, "set compaction throttle successfully", K(percent),
+          "mid_limit", up_limits_[ObDagPrio::DAG_PRIO_COMPACTION_MID],
+          "low_limit", up_limits_[ObDagPrio::DAG_PRIO_COMPACTION_LOW], K_(work_thread_num));
+    }
+  }
+  return ret;
+}
+
 int32_t ObTenantDagScheduler::get_running_task_cnt(const ObDagPrio::ObDagPrioEnum priority)
 {
   int32_t count = -1;
@@ -319,6 +319,7 @@ public:
     UNUSED(progress);
     return common::OB_NOT_IMPLEMENT;
   }
+  int64_t get_add_time() const { return add_time_; }
   int64_t get_start_time() const { return start_time_; }
   int add_child_without_inheritance(ObIDag &child);
   int add_child_without_inheritance(const common::ObIArray<ObINodeWithChild*> &child_array);
@@ -530,6 +531,9 @@ public:
     DAG_COUNT,
     DAG_NET_COUNT,
     RUNNING_TASK_CNT,
+    QUEUE_WAIT_TIME, // avg time from add_dag to the first schedule, us
+    QUEUE_WAIT_HIST, // count of dags whose queue wait is within the bucket
+    DISPATCH_LATENCY, // avg time from a task is dispatched to a worker until it runs, us
     VALUE_TYPE_MAX,
   };
   static const char *ObValueTypeStr[VALUE_TYPE_MAX];
@@ -701,7 +705,11 @@ public:
   void resume();
   void run1() override;
   void yield();
-  void set_task(ObITask *task) { task_ = task; }
+  void set_task(ObITask *task)
+  {
+    task_ = task;
+    dispatch_time_ = common::ObTimeUtility::fast_current_time();
+  }
   bool need_wake_up() const;
   ObITask *get_task() const { return task_; }
   static ObTenantDagWorker *self() { return self_; }
@@ -716,6 +724,7 @@ private:
   DagWorkerStatus status_;
   int64_t check_period_;
   int64_t last_check_time_;
+  int64_t dispatch_time_;
   int tg_id_;
   bool is_inited_;
 };
@@ -734,6 +743,7 @@ class ObTenantDagScheduler : public lib::TGRunnable
   friend class ObTenantDagWorker;
 public:
   static int mtl_init(ObTenantDagScheduler* &scheduler);
+  static const int64_t QUEUE_WAIT_HIST_BUCKET_CNT = 7;
 
 public:
   ObTenantDagScheduler();
@@ -781,8 +791,13 @@ public:
   int64_t get_cur_dag_cnt() const { return dag_cnt_; }
   int sys_task_start(ObIDag *dag);
   int64_t get_dag_count(const ObDagType::ObDagTypeEnum type);
+  void add_dispatch_latency(const int64_t priority, const int64_t latency);
   int32_t get_running_task_cnt(const ObDagPrio::ObDagPrioEnum priority);
   int32_t get_up_limit(const int64_t prio, int32_t &up_limit);
+  // scale the concurrency of minor and major compaction to %percent of the thread score,
+  // adjusted by ObCompactionThrottle
+  int set_compaction_throttle(const int64_t percent);
+  int64_t get_compaction_throttle() const { return ATOMIC_LOAD(&compaction_throttle_percent_); }
   int check_dag_exist(const ObIDag *dag, bool &exist);
   int cancel_dag(const ObIDag *dag, ObIDag *parent_dag = nullptr);
   int get_all_dag_info(
@@ -840,6 +855,7 @@ private:
   static const int64_t LOOP_PRINT_LOG_INTERVAL = 30 * 1000 * 1000L; // 30s
   static const int32_t MAX_SHOW_DAG_CNT_PER_PRIO = 100;
   static const int32_t MAX_SHOW_DAG_NET_CNT_PER_PRIO = 500;
+  static const int64_t DEFAULT_COMPACTION_THROTTLE_PERCENT = 100;
 private:
   enum DagNetMapIndex
   {
@@ -867,6 +883,7 @@ private:
   int dispatch_task(ObITask &task, ObTenantDagWorker *&ret_worker);
   void destroy_all_workers();
   int set_thread_score(const int64_t priority, const int32_t concurrency);
+  void update_limit(const int64_t priority);
   bool try_switch(ObTenantDagWorker &worker);
   int try_switch(ObTenantDagWorker &worker, const int64_t src_prio, const int64_t dest_prio, bool &need_pause);
   void pause_worker(ObTenantDagWorker &worker, const int64_t priority);
@@ -897,6 +914,11 @@ private:
   int generate_next_dag_(ObIDag *dag);
   int try_move_child_to_ready_list(ObIDag &dag);
   void inner_free_dag(ObIDag &dag);
+  void add_queue_wait_time(const ObIDag &dag);
+  int gene_schedule_stat_info(
+      ObDagSchedulerInfo *info_list,
+      common::ObIArray<void *> &scheduler_infos,
+      int64_t &idx);
 
 private:
   bool is_inited_;
@@ -917,8 +939,16 @@ private:
   int32_t running_task_cnts_[ObDagPrio::DAG_PRIO_MAX];
   int32_t low_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
   int32_t up_limits_[ObDagPrio::DAG_PRIO_MAX]; // wait to delete
+  int32_t thread_scores_[ObDagPrio::DAG_PRIO_MAX];
+  int64_t compaction_throttle_percent_;
   int64_t dag_cnts_[ObDagType::DAG_TYPE_MAX];
   int64_t dag_net_cnts_[ObDagNetType::DAG_NET_TYPE_MAX];
+  // statistics of scheduling, shown in __all_virtual_dag_scheduler
+  int64_t scheduled_dag_cnts_[ObDagType::DAG_TYPE_MAX];
+  int64_t queue_wait_times_[ObDagType::DAG_TYPE_MAX];
+  int64_t queue_wait_hists_[ObDagPrio::DAG_PRIO_MAX][QUEUE_WAIT_HIST_BUCKET_CNT];
+  int64_t dispatch_task_cnts_[ObDagPrio::DAG_PRIO_MAX];
+  int64_t dispatch_latencies_[ObDagPrio::DAG_PRIO_MAX];
   common::ObConcurrentFIFOAllocator allocator_;
   PriorityWorkerList waiting_workers_; // workers waiting for time slice to run
   PriorityWorkerList running_workers_; // running workers
@@ -4019,6 +4019,59 @@ int ObAggregateProcessor::sub_calc(
   return ret;
 }
 
+// Construct the number of the digits accumulated by number_accumulator, %desc is one of
+// the positive descs of the accumulated numbers.
+static void construct_fast_sum(
+    const uint32_t desc,
+    uint64_t sum_int_val,
+    uint64_t sum_frag_val,
+    uint32_t *sum_digits,
+    ObNumber &sum)
+{
+  uint64_t carry = 0;
+  sum.d_.desc_ = desc;
+  if (sum.d_.is_2d_positive_decimal() || sum.d_.is_1d_positive_integer()) {
+    // pattern1 a.b or a
+    if (sum_frag_val >= ObNumber::BASE) {
+      carry = sum_frag_val / ObNumber::BASE;
+      sum_frag_val = sum_frag_val % ObNumber::BASE;
+      sum.d_.len_ -= (sum_frag_val == 0);
+    }
+    sum_int_val += carry;
+    if (sum_int_val >= ObNumber::BASE) {
+      carry = sum_int_val / ObNumber::BASE;
+      sum_int_val = sum_int_val % ObNumber::BASE;
+      ++(sum.d_.exp_);
+      sum.d_.len_ = sum.d_.len_ + 1 - (sum_int_val == 0 && sum_frag_val == 0);
+      // performance critical: set the tailing digits even they are 0, no
+      // overflow risk
+      sum_digits[0] = static_cast<uint32_t>(carry);
+      sum_digits[1] = static_cast<uint32_t>(sum_int_val);
+      sum_digits[2] = static_cast<uint32_t>(sum_frag_val);
+    } else {
+      // performance critical: set the tailing digits even they are 0, no
+      // overflow risk
+      sum_digits[0] = static_cast<uint32_t>(sum_int_val);
+      sum_digits[1] = static_cast<uint32_t>(sum_frag_val);
+    }
+  } else if (sum.d_.is_1d_positive_fragment()) {
+    if (sum_frag_val >= ObNumber::BASE) {
+      carry = sum_frag_val / ObNumber::BASE;
+      sum_frag_val = sum_frag_val % ObNumber::BASE;
+      sum_int_val += carry;
+      sum.d_.len_ = sum.d_.len_ + 1 - (sum_frag_val == 0);
+      ++(sum.d_.exp_);
+      // performance critical: set the tailing digits even they are 0, no
+      // overflow risk
+      sum_digits[0] = static_cast<uint32_t>(sum_int_val);
+      sum_digits[1] = static_cast<uint32_t>(sum_frag_val);
+    } else {
+      sum_digits[0] = static_cast<uint32_t>(sum_frag_val);
+    }
+  }
+  sum.assign(sum.d_.desc_, sum_digits);
+}
+
 template <typename T>
 int ObAggregateProcessor::number_accumulator(
     const ObDatumVector &src,
@@ -4031,16 +4084,10 @@ int ObAggregateProcessor::number_accumulator(
 {
   int ret = OB_SUCCESS;
   ObNumber res;
-  ObNumber sum;
-  uint32_t counter1 = 0;
-  uint32_t counter2 = 0;
-  uint32_t counter3 = 0;
+  // the numbers of [1, 999999999].[000000001, 999999999] are accumulated in integers,
+  // the positive ones in sums[0] and the negative ones in sums[1] by their absolute value.
+  FastSum sums[2];
   uint32_t counter4 = 0;
-  uint32_t sum_desc1 = 0;
-  uint32_t sum_desc2 = 0;
-  uint32_t sum_desc3 = 0;
-  uint64_t sum_frag_val = 0;
-  uint64_t sum_int_val = 0;
 
   // TODO zuojiao.hzj: add new number accumulator to avoid memory allocate
   char buf_ori_result[ObNumber::MAX_CALC_BYTE_LEN];
@@ -4048,8 +4095,6 @@ int ObAggregateProcessor::number_accumulator(
   ObNumber ori_result;
   bool may_overflow = false;
   bool ori_result_copied = false;
-  // TODO qubin.qb: support negtive number, which range from
-  //  -[1, 999999999].[000000001, 999999999]
   uint16_t i = 0; // row num in a batch
   for (auto it = selector.begin(); OB_SUCC(ret) && it < selector.end(); selector.next(it)) {
     i = selector.get_batch_index(it);
@@ -4061,18 +4106,17 @@ int ObAggregateProcessor::number_accumulator(
     if (OB_UNLIKELY(src_num.is_zero())) {
       // do nothing
     } else if (src_num.d_.is_2d_positive_decimal()) {
-      sum_frag_val += src_num.get_digits()[1];
-      sum_int_val += src_num.get_digits()[0];
-      sum_desc1 = NUM_DESC_2DIGITS_POSITIVE_DECIMAL;
-      counter1++;
+      sums[0].add_decimal(src_num.get_digits());
     } else if (src_num.d_.is_1d_positive_fragment()) {
-      sum_frag_val += src_num.get_digits()[0];
-      sum_desc2 = NUM_DESC_1DIGIT_POSITIVE_FRAGMENT;
-      counter2++;
+      sums[0].add_fragment(src_num.get_digits());
     } else if (src_num.d_.is_1d_positive_integer()) {
-      sum_int_val += src_num.get_digits()[0];
-      sum_desc3 = NUM_DESC_1DIGIT_POSITIVE_INTEGER;
-      counter3++;
+      sums[0].add_integer(src_num.get_digits());
+    } else if (src_num.d_.is_2d_negative_decimal()) {
+      sums[1].add_decimal(src_num.get_digits());
+    } else if (src_num.d_.is_1d_negative_fragment()) {
+      sums[1].add_fragment(src_num.get_digits());
+    } else if (src_num.d_.is_1d_negative_integer()) {
+      sums[1].add_integer(src_num.get_digits());
     } else {
       if (OB_UNLIKELY(!ori_result_copied)) {
         // copy result to ori_result to fall back
@@ -4084,10 +4128,10 @@ int ObAggregateProcessor::number_accumulator(
         }
       }
       if (OB_UNLIKELY(src_num.fast_sum_agg_may_overflow() &&
-                      (counter1 > 0 || counter2 > 0 || counter3 > 0))) {
+                      (!sums[0].is_empty() || !sums[1].is_empty()))) {
         may_overflow = true;
         LOG_DEBUG("number accumulator may overflow, fall back to normal path",
-                  K(src_num), K(sum_int_val), K(sum_frag_val));
+                  K(src_num), K(sums[0]), K(sums[1]));
         break;
       } else {
         // normal path
@@ -4122,75 +4166,40 @@ int ObAggregateProcessor::number_accumulator(
       result.assign(res.d_.desc_, res.get_digits());
     }
   } else if (OB_SUCC(ret) && !all_skip) {
-    // construct sum result into number format
-    if (counter2 > 0 && counter3 > 0) {
-      sum.d_.desc_ = NUM_DESC_2DIGITS_POSITIVE_DECIMAL;
-    } else {
-      sum.d_.desc_ = std::max(sum_desc1, std::max(sum_desc2, sum_desc3));
-    }
-    uint64_t carry = 0;
-    if (sum.d_.is_2d_positive_decimal() || sum.d_.is_1d_positive_integer()) {
-      // pattern1 a.b or a
-      if (sum_frag_val >= ObNumber::BASE) {
-        carry = sum_frag_val / ObNumber::BASE;
-        sum_frag_val = sum_frag_val % ObNumber::BASE;
-        sum.d_.len_ -= (sum_frag_val == 0);
-      }
-      sum_int_val += carry;
-      if (sum_int_val >= ObNumber::BASE) {
-        carry = sum_int_val / ObNumber::BASE;
-        sum_int_val = sum_int_val % ObNumber::BASE;
-        ++(sum.d_.exp_);
-        sum.d_.len_ = sum.d_.len_ + 1 - (sum_int_val == 0 && sum_frag_val == 0);
-        // performance critical: set the tailing digits even they are 0, no
-        // overflow risk
-        sum_digits[0] = static_cast<uint32_t>(carry);
-        sum_digits[1] = static_cast<uint32_t>(sum_int_val);
-        sum_digits[2] = static_cast<uint32_t>(sum_frag_val);
-      } else {
-        // performance critical: set the tailing digits even they are 0, no
-        // overflow risk
-        sum_digits[0] = static_cast<uint32_t>(sum_int_val);
-        sum_digits[1] = static_cast<uint32_t>(sum_frag_val);
-      }
-    } else if (sum.d_.is_1d_positive_fragment()) {
-      if (sum_frag_val >= ObNumber::BASE) {
-        carry = sum_frag_val / ObNumber::BASE;
-        sum_frag_val = sum_frag_val % ObNumber::BASE;
-        sum_int_val += carry;
-        sum.d_.len_ = sum.d_.len_ + 1 - (sum_frag_val == 0);
-        ++(sum.d_.exp_);
-        // performance critical: set the tailing digits even they are 0, no
-        // overflow risk
-        sum_digits[0] = static_cast<uint32_t>(sum_int_val);
-        sum_digits[1] = static_cast<uint32_t>(sum_frag_val);
-      } else {
-        sum_digits[0] = static_cast<uint32_t>(sum_frag_val);
-      }
-    }
-    sum.assign(sum.d_.desc_, sum_digits);
-
-    if (counter4 == 0 && result.is_zero()) {
-      // all aggr result is filled in sum, just return sum
-      if (sum.d_.len_ == 0) {
-        result.set_zero();
-      } else {
-        result.assign(sum.d_.desc_, sum_digits);
+    for (int64_t k = 0; OB_SUCC(ret) && k < 2; ++k) {
+      if (sums[k].is_empty()) {
+        continue;
       }
-    } else {
-      // merge sum into aggr result
-      ObDataBuffer &allocator = (counter4 % 2 == 0) ? allocator1 : allocator2;
-      allocator.free();
-      if (OB_FAIL(result.add_v3(sum, res, allocator, true, true))) {
-        LOG_WARN("number_accumulator sum error", K(ret), K(sum), K(result));
+      // construct sum result into number format, the digits of the negative sum
+      // follow the ones of the positive sum.
+      ObNumber sum;
+      construct_fast_sum(sums[k].get_desc(), sums[k].int_val_, sums[k].frag_val_,
+                         sum_digits + k * FastSum::MAX_DIGIT_CNT, sum);
+      if (1 == k) {
+        sum = sum.negate();
+      }
+      if (counter4 == 0 && result.is_zero()) {
+        // all aggr result is filled in sum, just return sum
+        if (sum.d_.len_ == 0) {
+          result.set_zero();
+        } else {
+          result.assign(sum.d_.desc_, sum.get_digits());
+        }
       } else {
-        result.assign(res.d_.desc_, res.get_digits());
+        // merge sum into aggr result
+        ObDataBuffer &allocator = (counter4 % 2 == 0) ? allocator1 : allocator2;
+        allocator.free();
+        if (OB_FAIL(result.add_v3(sum, res, allocator, true, true))) {
+          LOG_WARN("number_accumulator sum error", K(ret), K(sum), K(result));
+        } else {
+          result.assign(res.d_.desc_, res.get_digits());
+          counter4++;
+        }
       }
     }
   }
 
-  LOG_DEBUG("number_accumulator done ", K(result), K(ret), K(counter1),
-            K(counter2), K(counter3), K(counter4));
+  LOG_DEBUG("number_accumulator done ", K(result), K(ret), K(sums[0]), K(sums[1]), K(counter4));
   return ret;
 }
 
@@ -669,8 +669,51 @@ private:
   int process_aggr_batch_result(
       const ObIArray<ObExpr *> *param_exprs,
       AggrCell &aggr_cell, const ObAggrInfo &aggr_info, const T &param);
+  // accumulate the digits of the numbers in [1, 999999999].[000000001, 999999999]
+  // of the same sign in integers, see number_accumulator.
+  struct FastSum
+  {
+    static const int64_t MAX_DIGIT_CNT = 3;
+    FastSum()
+      : int_val_(0), frag_val_(0), decimal_cnt_(0), fragment_cnt_(0), integer_cnt_(0)
+    {}
+    OB_INLINE void add_decimal(const uint32_t *digits)
+    {
+      int_val_ += digits[0];
+      frag_val_ += digits[1];
+      ++decimal_cnt_;
+    }
+    OB_INLINE void add_fragment(const uint32_t *digits)
+    {
+      frag_val_ += digits[0];
+      ++fragment_cnt_;
+    }
+    OB_INLINE void add_integer(const uint32_t *digits)
+    {
+      int_val_ += digits[0];
+      ++integer_cnt_;
+    }
+    bool is_empty() const { return 0 == decimal_cnt_ && 0 == fragment_cnt_ && 0 == integer_cnt_; }
+    // desc of the absolute value of the sum before carrying
+    uint32_t get_desc() const
+    {
+      uint32_t desc = NUM_DESC_1DIGIT_POSITIVE_FRAGMENT;
+      if (decimal_cnt_ > 0 || (fragment_cnt_ > 0 && integer_cnt_ > 0)) {
+        desc = NUM_DESC_2DIGITS_POSITIVE_DECIMAL;
+      } else if (integer_cnt_ > 0) {
+        desc = NUM_DESC_1DIGIT_POSITIVE_INTEGER;
+      }
+      return desc;
+    }
+    TO_STRING_KV(K_(int_val), K_(frag_val), K_(decimal_cnt), K_(fragment_cnt), K_(integer_cnt));
+    uint64_t int_val_;
+    uint64_t frag_val_;
+    uint32_t decimal_cnt_;
+    uint32_t fragment_cnt_;
+    uint32_t integer_cnt_;
+  };
   template <typename T>
-  int number_accumulator(
+  static int number_accumulator(
       const ObDatumVector &src, ObDataBuffer &allocator1, ObDataBuffer &allocator2,
       number::ObNumber &result, uint32_t *sum_digits, bool &all_skip, const T &param);
   template <typename T>
@@ -441,8 +441,18 @@ int ObLoadDataBase::pre_parse_lines(ObLoadFileBuffer &buffer,
   } else if (parser.get_opt_params().is_simple_format_) {
     const ObCSVGeneralFormat &format = parser.get_format();
     char *cur_pos = buffer.begin_ptr();
+    char *end = buffer.current_ptr();
     int64_t cur_lines = 0;
-    for (char *p = buffer.begin_ptr(); p < buffer.current_ptr(); ++p) {
+    // only escape char and line term char matter here, jump between them
+    ObCSVSpecialChars line_chars;
+    ObCSVFindSpecialCharFunc find_special_char = get_find_csv_special_char_func();
+    line_chars.add(parser.get_opt_params().line_term_c_);
+    if (INT64_MAX != format.field_escaped_char_) {
+      line_chars.add(static_cast<char>(format.field_escaped_char_));
+    }
+    for (char *p = const_cast<char *>(find_special_char(cur_pos, end, line_chars));
+         p < end;
+         p = const_cast<char *>(find_special_char(p + 1, end, line_chars))) {
       char cur_char = *p;
       if (format.field_escaped_char_ == cur_char && p + 1 < buffer.current_ptr()) {
         p++;
@@ -15,6 +15,7 @@
 #include "sql/engine/cmd/ob_load_data_parser.h"
 #include "sql/resolver/cmd/ob_load_data_stmt.h"
 #include "lib/oblog/ob_log_module.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
@@ -63,6 +64,26 @@ int ObCSVGeneralParser::init(const ObDataInFileStruct &format,
         && !opt_param_.is_same_escape_enclosed_
         && format_.field_enclosed_char_ == INT64_MAX;
 
+    if (CHARSET_UTF8MB4 == format_.cs_type_ || CHARSET_BINARY == format_.cs_type_) {
+      bool is_all_ascii = true;
+      ObCSVSpecialChars &special_chars = opt_param_.special_chars_;
+      const int64_t chars[] = { format_.field_term_str_.empty() ? INT64_MAX : opt_param_.field_term_c_,
+                                format_.line_term_str_.empty() ? INT64_MAX : opt_param_.line_term_c_,
+                                format_.field_escaped_char_,
+                                format_.field_enclosed_char_ };
+      for (int64_t i = 0; is_all_ascii && i < ARRAYSIZEOF(chars); ++i) {
+        if (INT64_MAX == chars[i]) {
+          // not used
+        } else if (chars[i] < 0 || chars[i] > INT8_MAX) {
+          is_all_ascii = false;
+        } else {
+          is_all_ascii = special_chars.add(static_cast<char>(chars[i]));
+        }
+      }
+      if (is_all_ascii && !special_chars.empty()) {
+        opt_param_.find_special_char_ = get_find_csv_special_char_func();
+      }
+    }
   }
 
   if (OB_SUCC(ret) && OB_FAIL(fields_per_line_.prepare_allocate(file_column_nums))) {
@@ -72,6 +93,26 @@ int ObCSVGeneralParser::init(const ObDataInFileStruct &format,
   return ret;
 }
 
+const char *find_csv_special_char(const char *str,
+                                  const char *end,
+                                  const ObCSVSpecialChars &chars)
+{
+  const char *pos = str;
+  for (; pos < end; ++pos) {
+    const char c = *pos;
+    if (c == chars.chars_[0] || c == chars.chars_[1]
+        || c == chars.chars_[2] || c == chars.chars_[3]) {
+      break;
+    }
+  }
+  return pos;
+}
+
+ObCSVFindSpecialCharFunc get_find_csv_special_char_func()
+{
+  return blocksstable::is_avx2_valid() ? find_csv_special_char_avx2 : find_csv_special_char;
+}
+
 int ObCSVGeneralParser::handle_irregular_line(int field_idx, int line_no,
                                               ObIArray<LineErrRec> &errors)
 {
@@ -40,6 +40,53 @@ struct ObCSVGeneralFormat {
   int64_t file_column_nums_;
 };
 
+/**
+ * @brief Set of single byte chars which have special meaning in csv data,
+ *        such as terminators, escape char and enclose char.
+ *        Unused slots are filled with the first char to make the set
+ *        friendly to simd comparison.
+ */
+struct ObCSVSpecialChars
+{
+  static const int64_t MAX_CHAR_CNT = 4;
+  ObCSVSpecialChars() : cnt_(0) { MEMSET(chars_, 0, sizeof(chars_)); }
+  bool add(const char c)
+  {
+    bool bret = true;
+    if (0 == cnt_) {
+      MEMSET(chars_, c, sizeof(chars_));
+      chars_[cnt_++] = c;
+    } else if (nullptr != MEMCHR(chars_, c, cnt_)) {
+      // already exists
+    } else if (cnt_ < MAX_CHAR_CNT) {
+      chars_[cnt_++] = c;
+    } else {
+      bret = false;
+    }
+    return bret;
+  }
+  bool empty() const { return 0 == cnt_; }
+  TO_STRING_KV(K_(cnt), "chars", common::ObString(cnt_, chars_));
+
+  char chars_[MAX_CHAR_CNT];
+  int64_t cnt_;
+};
+
+// Return the first position in [str, end) which holds one of the special chars,
+// return end if not found.
+typedef const char *(*ObCSVFindSpecialCharFunc)(const char *str,
+                                                const char *end,
+                                                const ObCSVSpecialChars &chars);
+const char *find_csv_special_char(const char *str,
+                                  const char *end,
+                                  const ObCSVSpecialChars &chars);
+// 32 bytes per round with avx2, defined in ob_load_data_parser_simd.cpp
+const char *find_csv_special_char_avx2(const char *str,
+                                       const char *end,
+                                       const ObCSVSpecialChars &chars);
+// choose the avx2 version if current cpu supports it
+ObCSVFindSpecialCharFunc get_find_csv_special_char_func();
+
 /**
  * @brief Fast csv general parser is mysql compatible csv parser
  *        It support single-byte or multi-byte seperators
@@ -73,7 +120,9 @@ public:
       is_filling_zero_to_empty_field_(false),
       is_line_term_by_counting_field_(false),
       is_same_escape_enclosed_(false),
-      is_simple_format_(false)
+      is_simple_format_(false),
+      special_chars_(),
+      find_special_char_(nullptr)
     {}
     char line_term_c_;
     char field_term_c_;
@@ -81,6 +130,12 @@ public:
     bool is_line_term_by_counting_field_;
     bool is_same_escape_enclosed_;
     bool is_simple_format_;
+    // Chars which may begin a terminator, an escape or an enclose. Only valid when all
+    // of them are ascii chars and the charset never uses ascii bytes inside a multi-byte
+    // char (utf8mb4 and binary), in which case the bytes between two special chars can
+    // be skipped as a whole by find_special_char_, otherwise find_special_char_ is null.
+    ObCSVSpecialChars special_chars_;
+    ObCSVFindSpecialCharFunc find_special_char_;
   };
 public:
   ObCSVGeneralParser() {}
@@ -329,8 +384,13 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
                     && (!is_enclosed || (str - 1 == last_end_enclosed));
 
           if (!is_term) {
-            int mb_len = mbcharlen<cs_type>(str, end);
-            str += mb_len;
+            if (nullptr != opt_param_.find_special_char_) {
+              // no special char in between, skip to the next candidate directly
+              str = opt_param_.find_special_char_(str + 1, end, opt_param_.special_chars_);
+            } else {
+              int mb_len = mbcharlen<cs_type>(str, end);
+              str += mb_len;
+            }
           }
         }
       }
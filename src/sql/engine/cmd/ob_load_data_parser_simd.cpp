@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/cmd/ob_load_data_parser.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace oceanbase
+{
+namespace sql
+{
+
+const char *find_csv_special_char_avx2(const char *str,
+                                       const char *end,
+                                       const ObCSVSpecialChars &chars)
+{
+  const char *pos = str;
+#if defined(__x86_64__)
+  const __m256i c0 = _mm256_set1_epi8(chars.chars_[0]);
+  const __m256i c1 = _mm256_set1_epi8(chars.chars_[1]);
+  const __m256i c2 = _mm256_set1_epi8(chars.chars_[2]);
+  const __m256i c3 = _mm256_set1_epi8(chars.chars_[3]);
+  bool found = false;
+  for (; pos + sizeof(__m256i) <= end; pos += sizeof(__m256i)) {
+    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+    const __m256i match = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(data, c0), _mm256_cmpeq_epi8(data, c1)),
+        _mm256_or_si256(_mm256_cmpeq_epi8(data, c2), _mm256_cmpeq_epi8(data, c3)));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+    if (0 != mask) {
+      pos += __builtin_ctz(mask);
+      found = true;
+      break;
+    }
+  }
+  if (!found) {
+    pos = find_csv_special_char(pos, end, chars);
+  }
+#else
+  pos = find_csv_special_char(pos, end, chars);
+#endif
+  return pos;
+}
+
+}  // namespace sql
+}  // namespace oceanbase
@@ -27,6 +27,7 @@ public:
     ZONE_TYPE,
     MERGE_STATUS,
     POS_TYPE,
+    REPLICA_TYPE,
     CMP_CNT
   };
   enum CompareRes
@@ -45,6 +46,8 @@ public:
                                          const ObRoutePolicy::CandidateReplica &replica2);
   inline CompareRes compare_zone_type(const ObRoutePolicy::CandidateReplica &replica1,
                                          const ObRoutePolicy::CandidateReplica &replica2);
+  inline CompareRes compare_replica_type(const ObRoutePolicy::CandidateReplica &replica1,
+                                         const ObRoutePolicy::CandidateReplica &replica2);
   inline CompareRes compare_merge_status(const ObRoutePolicy::CandidateReplica &replica1,
                                          const ObRoutePolicy::CandidateReplica &replica2);
   inline CompareRes compare_pos_type(const ObRoutePolicy::CandidateReplica &replica1,
@@ -90,6 +93,22 @@ ObReplicaCompare::CompareRes ObReplicaCompare::compare_zone_type(const ObRoutePo
   return cmp_ret;
 }
 
+// among the replicas at the same position, read only replicas are preferred by weak read,
+// so that the analytical queries do not compete with the transactions on the full replicas
+ObReplicaCompare::CompareRes ObReplicaCompare::compare_replica_type(const ObRoutePolicy::CandidateReplica &replica1,
+                                               const ObRoutePolicy::CandidateReplica &replica2)
+{
+  CompareRes cmp_ret = EQUAL;
+  if (replica1.attr_.replica_type_ == common::REPLICA_TYPE_READONLY
+      && replica2.attr_.replica_type_ != common::REPLICA_TYPE_READONLY) {
+    cmp_ret = LESS;
+  } else if (replica1.attr_.replica_type_ != common::REPLICA_TYPE_READONLY
+             && replica2.attr_.replica_type_ == common::REPLICA_TYPE_READONLY) {
+    cmp_ret = GREATER;
+  } else {/*do nothing*/}
+  return cmp_ret;
+}
+
 ObReplicaCompare::CompareRes ObReplicaCompare::compare_merge_status(const ObRoutePolicy::CandidateReplica &replica1,
                                                const ObRoutePolicy::CandidateReplica &replica2)
 {
@@ -142,6 +142,7 @@ int ObRoutePolicy::init_candidate_replica(const ObIArray<share::ObServerLocality
     LOG_WARN("fail to calc postion type", K(server_locality_array), K(ret));
   } else {
     candi_replica.attr_.zone_type_ = candi_locality.get_zone_type();
+    candi_replica.attr_.replica_type_ = candi_replica.get_replica_type();
     candi_replica.attr_.start_service_time_ = candi_locality.get_start_service_time();
     candi_replica.attr_.server_stop_time_ = candi_locality.get_server_stop_time();
     candi_replica.attr_.server_status_ = candi_locality.get_server_status();
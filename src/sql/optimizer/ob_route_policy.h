@@ -83,6 +83,7 @@ public:
         merge_status_(MERGE_STATUS_MAX),
         zone_status_(share::ObZoneStatus::UNKNOWN),
         zone_type_(common::ZONE_TYPE_INVALID),
+        replica_type_(common::REPLICA_TYPE_MAX),
         start_service_time_(0),
         server_stop_time_(0),
         server_status_(share::ObServerStatus::OB_DISPLAY_MAX)
@@ -92,7 +93,8 @@ public:
     {
       bool bool_ret = false;
       if (merge_status_ == other_attr.merge_status_
-          && zone_type_ == other_attr.zone_type_) {
+          && zone_type_ == other_attr.zone_type_
+          && replica_type_ == other_attr.replica_type_) {
         if (pos_type_ == SAME_SERVER) {
           bool_ret = (other_attr.pos_type_ == SAME_SERVER || other_attr.pos_type_ == SAME_IDC);
         } else if (pos_type_ == SAME_IDC) {
@@ -109,15 +111,17 @@ public:
       merge_status_ = MERGE_STATUS_MAX;
       zone_status_ = share::ObZoneStatus::UNKNOWN;
       zone_type_ = common::ZONE_TYPE_INVALID;
+      replica_type_ = common::REPLICA_TYPE_MAX;
       start_service_time_ = 0;
       server_stop_time_ = 0;
       server_status_ = share::ObServerStatus::OB_DISPLAY_MAX;
     }
-    TO_STRING_KV(K(pos_type_), K(merge_status_), K(zone_type_), K(zone_status_), K(start_service_time_), K(server_stop_time_), K(server_status_));
+    TO_STRING_KV(K(pos_type_), K(merge_status_), K(zone_type_), K(replica_type_), K(zone_status_), K(start_service_time_), K(server_stop_time_), K(server_status_));
     PositionType pos_type_;
     MergeStatus merge_status_;
     share::ObZoneStatus::Status zone_status_;
     common::ObZoneType zone_type_;
+    common::ObReplicaType replica_type_;
     int64_t start_service_time_;
     int64_t server_stop_time_;
     share::ObServerStatus::DisplayStatus server_status_;
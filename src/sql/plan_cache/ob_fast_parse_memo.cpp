@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include "sql/plan_cache/ob_fast_parse_memo.h"
+#include "lib/thread_local/ob_tsi_factory.h"
+#include "sql/plan_cache/ob_plan_cache_struct.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+ObFastParseMemo::Entry::Entry()
+  : key_(), no_param_sql_(), params_(nullptr), param_cnt_(0),
+    allocator_("FastParseMemo", OB_MALLOC_NORMAL_BLOCK_SIZE)
+{
+}
+
+void ObFastParseMemo::Entry::reset()
+{
+  key_ = ObFastParseMemoKey();
+  no_param_sql_.reset();
+  params_ = nullptr;
+  param_cnt_ = 0;
+  // the pages may belong to another tenant, free them
+  allocator_.reset();
+}
+
+ObFastParseMemo::ObFastParseMemo()
+  : next_victim_(0)
+{
+}
+
+ObFastParseMemo::~ObFastParseMemo()
+{
+  for (int64_t i = 0; i < MAX_ENTRY_CNT; ++i) {
+    entries_[i].reset();
+  }
+}
+
+ObFastParseMemo *ObFastParseMemo::get_thread_memo()
+{
+  return GET_TSI(ObFastParseMemo);
+}
+
+int ObFastParseMemo::copy_node(const ParseNode &src, ObIAllocator &allocator, ParseNode *&dst)
+{
+  int ret = OB_SUCCESS;
+  char *buf = nullptr;
+  dst = nullptr;
+  if (OB_ISNULL(dst = static_cast<ParseNode *>(allocator.alloc(sizeof(ParseNode))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc parse node", K(ret));
+  } else {
+    // no pointer of %dst may refer to the memory of %src, including the empty strings
+    *dst = src;
+    dst->str_value_ = nullptr;
+    dst->raw_text_ = nullptr;
+    dst->children_ = nullptr;
+    if (nullptr != src.str_value_) {
+      const int64_t str_len = MAX(src.str_len_, 0);
+      if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(str_len + 1)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc str value", K(ret), K(src.str_len_));
+      } else {
+        MEMCPY(buf, src.str_value_, str_len);
+        buf[str_len] = '\0';
+        dst->str_value_ = buf;
+      }
+    }
+    if (OB_SUCC(ret) && nullptr != src.raw_text_) {
+      const int64_t text_len = MAX(src.text_len_, 0);
+      if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(text_len + 1)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc raw text", K(ret), K(src.text_len_));
+      } else {
+        MEMCPY(buf, src.raw_text_, text_len);
+        buf[text_len] = '\0';
+        dst->raw_text_ = buf;
+      }
+    }
+    if (OB_SUCC(ret) && src.num_child_ > 0 && nullptr != src.children_) {
+      if (OB_ISNULL(dst->children_ = static_cast<ParseNode **>(
+                    allocator.alloc(sizeof(ParseNode *) * src.num_child_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc children", K(ret), K(src.num_child_));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < src.num_child_; ++i) {
+        dst->children_[i] = nullptr;
+        if (nullptr != src.children_[i]
+            && OB_FAIL(copy_node(*src.children_[i], allocator, dst->children_[i]))) {
+          LOG_WARN("failed to copy child node", K(ret), K(i));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFastParseMemo::get(const ObFastParseMemoKey &key,
+                         ObIAllocator &allocator,
+                         ObFastParserResult &fp_result,
+                         bool &is_hit)
+{
+  int ret = OB_SUCCESS;
+  const Entry *entry = nullptr;
+  is_hit = false;
+  for (int64_t i = 0; nullptr == entry && i < MAX_ENTRY_CNT; ++i) {
+    if (entries_[i].key_ == key) {
+      entry = &entries_[i];
+    }
+  }
+  if (nullptr != entry) {
+    char *no_param_sql = nullptr;
+    char *ptr = nullptr;
+    if (OB_ISNULL(no_param_sql = static_cast<char *>(
+                  allocator.alloc(entry->no_param_sql_.length() + 1)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc no param sql", K(ret));
+    } else {
+      MEMCPY(no_param_sql, entry->no_param_sql_.ptr(), entry->no_param_sql_.length());
+      fp_result.pc_key_.name_.assign_ptr(no_param_sql, entry->no_param_sql_.length());
+    }
+    if (OB_SUCC(ret) && entry->param_cnt_ > 0) {
+      fp_result.raw_params_.set_allocator(&allocator);
+      fp_result.raw_params_.set_capacity(entry->param_cnt_);
+      if (OB_ISNULL(ptr = static_cast<char *>(
+                    allocator.alloc(entry->param_cnt_ * sizeof(ObPCParam))))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc pc params", K(ret));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < entry->param_cnt_; ++i) {
+        ObPCParam *pc_param = new(ptr)ObPCParam();
+        ptr += sizeof(ObPCParam);
+        if (OB_FAIL(copy_node(*entry->params_[i], allocator, pc_param->node_))) {
+          LOG_WARN("failed to copy param node", K(ret), K(i));
+        } else if (OB_FAIL(fp_result.raw_params_.push_back(pc_param))) {
+          LOG_WARN("failed to push back pc param", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      is_hit = true;
+    }
+  }
+  return ret;
+}
+
+int ObFastParseMemo::put(const ObFastParseMemoKey &key, const ObFastParserResult &fp_result)
+{
+  int ret = OB_SUCCESS;
+  const int64_t param_cnt = fp_result.raw_params_.count();
+  const ObString &no_param_sql = fp_result.pc_key_.name_;
+  if (!can_memorize(key.sql_) || param_cnt > MAX_PARAM_CNT) {
+    // not memorized
+  } else {
+    Entry &entry = entries_[next_victim_];
+    char *sql_buf = nullptr;
+    char *no_param_sql_buf = nullptr;
+    next_victim_ = (next_victim_ + 1) % MAX_ENTRY_CNT;
+    entry.reset();
+    entry.allocator_.set_attr(ObMemAttr(key.tenant_id_, "FastParseMemo"));
+    if (OB_ISNULL(sql_buf = static_cast<char *>(entry.allocator_.alloc(key.sql_.length())))
+        || OB_ISNULL(no_param_sql_buf = static_cast<char *>(
+                     entry.allocator_.alloc(no_param_sql.length() + 1)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc memory", K(ret));
+    } else if (param_cnt > 0
+               && OB_ISNULL(entry.params_ = static_cast<ParseNode **>(
+                            entry.allocator_.alloc(sizeof(ParseNode *) * param_cnt)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc params", K(ret), K(param_cnt));
+    } else {
+      MEMCPY(sql_buf, key.sql_.ptr(), key.sql_.length());
+      MEMCPY(no_param_sql_buf, no_param_sql.ptr(), no_param_sql.length());
+      no_param_sql_buf[no_param_sql.length()] = '\0';
+      entry.no_param_sql_.assign_ptr(no_param_sql_buf, no_param_sql.length());
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < param_cnt; ++i) {
+      const ObPCParam *pc_param = fp_result.raw_params_.at(i);
+      if (OB_ISNULL(pc_param) || OB_ISNULL(pc_param->node_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("invalid pc param", K(ret), K(i), KP(pc_param));
+      } else if (OB_FAIL(copy_node(*pc_param->node_, entry.allocator_, entry.params_[i]))) {
+        LOG_WARN("failed to copy param node", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret) && entry.allocator_.total() > MAX_ENTRY_MEM_HOLD) {
+      // too large to keep, e.g. long string literals
+      entry.reset();
+    } else if (OB_SUCC(ret)) {
+      entry.key_ = key;
+      entry.key_.sql_.assign_ptr(sql_buf, key.sql_.length());
+      entry.param_cnt_ = param_cnt;
+    } else {
+      entry.reset();
+    }
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
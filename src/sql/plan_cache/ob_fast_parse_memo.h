@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_FAST_PARSE_MEMO_H_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_FAST_PARSE_MEMO_H_
+
+#include "lib/allocator/page_arena.h"
+#include "lib/string/ob_string.h"
+#include "lib/charset/ob_charset.h"
+#include "common/sql_mode/ob_sql_mode.h"
+#include "sql/parser/parse_node.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+struct ObFastParserResult;
+
+// Key of a memorized fast parser result, the result of fast parser only depends on
+// the sql text and the arguments below.
+struct ObFastParseMemoKey
+{
+  ObFastParseMemoKey()
+    : tenant_id_(common::OB_INVALID_TENANT_ID), sql_(), sql_mode_(0),
+      conn_coll_(common::CS_TYPE_INVALID), is_oracle_mode_(false),
+      enable_batched_multi_stmt_(false), hash_val_(0)
+  {}
+  ObFastParseMemoKey(const uint64_t tenant_id,
+                     const common::ObString &sql,
+                     const ObSQLMode sql_mode,
+                     const common::ObCollationType conn_coll,
+                     const bool is_oracle_mode,
+                     const bool enable_batched_multi_stmt)
+    : tenant_id_(tenant_id), sql_(sql), sql_mode_(sql_mode), conn_coll_(conn_coll),
+      is_oracle_mode_(is_oracle_mode), enable_batched_multi_stmt_(enable_batched_multi_stmt),
+      hash_val_(0)
+  {
+    hash_val_ = sql_.hash();
+  }
+  bool operator==(const ObFastParseMemoKey &other) const
+  {
+    return hash_val_ == other.hash_val_
+        && tenant_id_ == other.tenant_id_
+        && sql_mode_ == other.sql_mode_
+        && conn_coll_ == other.conn_coll_
+        && is_oracle_mode_ == other.is_oracle_mode_
+        && enable_batched_multi_stmt_ == other.enable_batched_multi_stmt_
+        && sql_ == other.sql_;
+  }
+  TO_STRING_KV(K_(tenant_id), K_(sql), K_(sql_mode), K_(conn_coll), K_(is_oracle_mode),
+               K_(enable_batched_multi_stmt), K_(hash_val));
+
+  // the memory of the memorized result is accounted to this tenant
+  uint64_t tenant_id_;
+  common::ObString sql_;
+  ObSQLMode sql_mode_;
+  common::ObCollationType conn_coll_;
+  bool is_oracle_mode_;
+  bool enable_batched_multi_stmt_;
+  uint64_t hash_val_;
+};
+
+// Thread local memo of the recent fast parser results.
+//
+// OLTP applications send the same short statements again and again (e.g. connector
+// probes, session setup statements, point queries of hot rows), for which the
+// tokenizing of fast parser is repeated for identical text. The memo keeps the
+// parameterized sql and the parameter nodes of the most recent statements, a hit
+// only costs a hash and a compare of the sql text plus copying the result into the
+// caller's allocator.
+//
+// Only statements not longer than MAX_SQL_LEN are memorized. The memory of an entry
+// is labeled with the tenant of the statement and limited to MAX_ENTRY_MEM_HOLD, so
+// a worker thread holds at most MAX_ENTRY_CNT * MAX_ENTRY_MEM_HOLD for the memo.
+class ObFastParseMemo
+{
+public:
+  static const int64_t MAX_ENTRY_CNT = 16;
+  static const int64_t MAX_SQL_LEN = 1024;
+  static const int64_t MAX_PARAM_CNT = 64;
+  static const int64_t MAX_ENTRY_MEM_HOLD = 32L * 1024L; // 32KB
+
+  ObFastParseMemo();
+  ~ObFastParseMemo();
+  static ObFastParseMemo *get_thread_memo();
+
+  // copy the memorized result into %fp_result, %is_hit is false if not found.
+  int get(const ObFastParseMemoKey &key,
+          common::ObIAllocator &allocator,
+          ObFastParserResult &fp_result,
+          bool &is_hit);
+  // memorize the result of fast parser, the oldest entry is replaced.
+  int put(const ObFastParseMemoKey &key, const ObFastParserResult &fp_result);
+  static bool can_memorize(const common::ObString &sql)
+  {
+    return sql.length() > 0 && sql.length() <= MAX_SQL_LEN;
+  }
+private:
+  struct Entry
+  {
+    Entry();
+    void reset();
+    TO_STRING_KV(K_(key), K_(no_param_sql), K_(param_cnt));
+
+    ObFastParseMemoKey key_;
+    common::ObString no_param_sql_;
+    ParseNode **params_;
+    int64_t param_cnt_;
+    common::ObArenaAllocator allocator_;
+  };
+  static int copy_node(const ParseNode &src, common::ObIAllocator &allocator, ParseNode *&dst);
+private:
+  Entry entries_[MAX_ENTRY_CNT];
+  int64_t next_victim_;
+  DISALLOW_COPY_AND_ASSIGN(ObFastParseMemo);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_SQL_PLAN_CACHE_OB_FAST_PARSE_MEMO_H_ */
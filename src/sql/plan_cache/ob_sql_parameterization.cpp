@@ -17,6 +17,7 @@
 #include "sql/engine/ob_exec_context.h"
 #include "sql/parser/ob_parser.h"
 #include "sql/parser/ob_fast_parser.h"
+#include "sql/plan_cache/ob_fast_parse_memo.h"
 #include "sql/resolver/ob_resolver_utils.h"
 #include "sql/parser/parse_malloc.h"
 #include "sql/ob_sql_utils.h"
@@ -1193,12 +1194,32 @@ int ObSqlParameterization::fast_parser(ObIAllocator &allocator,
     || (ObParser::is_pl_stmt(sql, nullptr, &is_call_procedure) && !is_call_procedure))) {
     (void)fp_result.pc_key_.name_.assign_ptr(sql.ptr(), sql.length());
   } else if (GCONF._ob_enable_fast_parser) {
-    if (OB_FAIL(ObFastParser::parse(sql, enable_batched_multi_stmt, no_param_sql_ptr,
-                no_param_sql_len, p_list, param_num, connection_collation, allocator, sql_mode))) {
-      LOG_WARN("fast parse error", K(param_num),
-              K(ObString(no_param_sql_len, no_param_sql_ptr)), K(sql));
+    bool is_memo_hit = false;
+    ObFastParseMemo *memo = NULL;
+    ObFastParseMemoKey memo_key;
+    if (GCONF._enable_fast_parse_memo
+        && ObFastParseMemo::can_memorize(sql)
+        && OB_NOT_NULL(memo = ObFastParseMemo::get_thread_memo())) {
+      memo_key = ObFastParseMemoKey(MTL_ID(), sql, sql_mode, connection_collation,
+                                    lib::is_oracle_mode(), enable_batched_multi_stmt);
+      if (OB_FAIL(memo->get(memo_key, allocator, fp_result, is_memo_hit))) {
+        LOG_WARN("failed to get fast parse result from memo", K(ret), K(sql));
+      } else if (is_memo_hit) {
+        EVENT_INC(SQL_FAST_PARSE_MEMO_HIT);
+      }
     }
-    if (OB_SUCC(ret)) {
+    if (OB_FAIL(ret) || is_memo_hit) {
+    } else {
+      const int64_t parse_start_ts = ObTimeUtility::current_time();
+      if (OB_FAIL(ObFastParser::parse(sql, enable_batched_multi_stmt, no_param_sql_ptr,
+                  no_param_sql_len, p_list, param_num, connection_collation, allocator, sql_mode))) {
+        LOG_WARN("fast parse error", K(param_num),
+                K(ObString(no_param_sql_len, no_param_sql_ptr)), K(sql));
+      }
+      EVENT_INC(SQL_FAST_PARSE_COUNT);
+      EVENT_ADD(SQL_FAST_PARSE_TIME, ObTimeUtility::current_time() - parse_start_ts);
+    }
+    if (OB_SUCC(ret) && !is_memo_hit) {
       (void)fp_result.pc_key_.name_.assign_ptr(no_param_sql_ptr, no_param_sql_len);
       if (param_num > 0) {
         ObPCParam *pc_param = NULL;
@@ -1220,6 +1241,12 @@ int ObSqlParameterization::fast_parser(ObIAllocator &allocator,
           }
         } // for end
       } else { /*do nothing*/}
+      if (OB_SUCC(ret) && NULL != memo) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = memo->put(memo_key, fp_result))) {
+          LOG_WARN("failed to put fast parse result into memo", K(tmp_ret), K(sql));
+        }
+      }
     }
   } else {
     ObParser parser(allocator, sql_mode, connection_collation);
@@ -63,8 +63,8 @@ int ObDataMacroBlockMergeWriter::append_row(
   if (OB_NOT_NULL(curr_macro_desc) && OB_UNLIKELY(!curr_macro_desc->is_valid_with_macro_meta())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid macro desc", K(ret));
-  } else {
-    adjust_freespace(curr_macro_desc);
+  } else if (OB_FAIL(adjust_freespace(curr_macro_desc))) {
+    STORAGE_LOG(WARN, "fail to adjust freespace", K(ret));
   }
 
   if (OB_FAIL(ret)) {
@@ -83,8 +83,8 @@ int ObDataMacroBlockMergeWriter::append_micro_block(
   if (OB_NOT_NULL(curr_macro_desc) && OB_UNLIKELY(!curr_macro_desc->is_valid_with_macro_meta())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid macro desc", K(ret));
-  } else {
-    adjust_freespace(curr_macro_desc);
+  } else if (OB_FAIL(adjust_freespace(curr_macro_desc))) {
+    STORAGE_LOG(WARN, "fail to adjust freespace", K(ret));
   }
 
   if (OB_FAIL(ret)) {
@@ -102,18 +102,32 @@ int ObDataMacroBlockMergeWriter::append_micro_block(
 
 int ObDataMacroBlockMergeWriter::append_macro_block(const ObMacroBlockDesc &macro_desc)
 {
-  next_block_use_freespace_ = false;
-  return ObMacroBlockWriter::append_macro_block(macro_desc);
+  int ret = OB_SUCCESS;
+  // the micro blocks in the compress pipeline are written with the current freespace setting
+  if (OB_FAIL(flush_compress_pipeline())) {
+    STORAGE_LOG(WARN, "fail to flush compress pipeline", K(ret));
+  } else {
+    next_block_use_freespace_ = false;
+    ret = ObMacroBlockWriter::append_macro_block(macro_desc);
+  }
+  return ret;
 }
 
-void ObDataMacroBlockMergeWriter::adjust_freespace(const ObMacroBlockDesc *curr_macro_desc)
+int ObDataMacroBlockMergeWriter::adjust_freespace(const ObMacroBlockDesc *curr_macro_desc)
 {
+  int ret = OB_SUCCESS;
   if (OB_NOT_NULL(curr_macro_desc) && curr_macro_logic_id_ != curr_macro_desc->macro_meta_->get_logic_id()) {
-    curr_macro_logic_id_ = curr_macro_desc->macro_meta_->get_logic_id();
-    is_use_freespace_ = static_cast<blocksstable::ObDataMacroBlockMeta *>(curr_macro_desc->macro_meta_)->val_.data_zsize_
-                        + get_macro_data_size() <= data_store_desc_->macro_block_size_;
-    next_block_use_freespace_ = !is_use_freespace_;
+    // the macro data size must include all the micro blocks built before
+    if (OB_FAIL(flush_compress_pipeline())) {
+      STORAGE_LOG(WARN, "fail to flush compress pipeline", K(ret));
+    } else {
+      curr_macro_logic_id_ = curr_macro_desc->macro_meta_->get_logic_id();
+      is_use_freespace_ = static_cast<blocksstable::ObDataMacroBlockMeta *>(curr_macro_desc->macro_meta_)->val_.data_zsize_
+                          + get_macro_data_size() <= data_store_desc_->macro_block_size_;
+      next_block_use_freespace_ = !is_use_freespace_;
+    }
   }
+  return ret;
 }
 
 bool ObDataMacroBlockMergeWriter::check_need_switch_macro_block()
@@ -144,6 +158,18 @@ int ObDataMacroBlockMergeWriter::build_micro_block()
   return ret;
 }
 
+int ObDataMacroBlockMergeWriter::after_compressed_micro_block_written()
+{
+  int ret = OB_SUCCESS;
+  // same as check_need_switch_macro_block() after a micro block is built and written inline
+  if (!is_use_freespace_ && get_written_macro_data_size() >= data_store_desc_->macro_store_size_) {
+    if (OB_FAIL(try_switch_macro_block())) {
+      STORAGE_LOG(WARN, "fail to try switch macro block", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObDataMacroBlockMergeWriter::try_switch_macro_block()
 {
   int ret = OB_SUCCESS;
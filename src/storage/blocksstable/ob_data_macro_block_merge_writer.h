@@ -40,9 +40,10 @@ protected:
   virtual int build_micro_block() override;
   virtual int try_switch_macro_block() override;
   virtual bool is_keep_freespace() const override {return !is_use_freespace_; }
+  virtual int after_compressed_micro_block_written() override;
 
 private:
-  void adjust_freespace(const ObMacroBlockDesc *curr_macro_desc);
+  int adjust_freespace(const ObMacroBlockDesc *curr_macro_desc);
   bool check_need_switch_macro_block();
 private:
   ObLogicMacroBlockId curr_macro_logic_id_;
@@ -708,6 +708,9 @@ int ObSSTableIndexBuilder::build_meta_tree(ObSSTableMergeRes &res)
   ObMacroBlocksWriteCtx *index_write_ctx = nullptr;
   ObMetaIndexBlockBuilder &builder = data_builder_;
   ObDataStoreDesc &desc = container_store_desc_;
+  // the leaf row is copied into the micro block once appended, so the memory of the
+  // serialized macro meta is reused for every row instead of growing with the data size.
+  ObArenaAllocator row_allocator("MetaTreeRow", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID());
   start_seq.set_macro_meta_block();
   if (OB_FAIL(macro_writer_.open(desc, start_seq, callback_))) {
     STORAGE_LOG(WARN, "fail to open index macro writer", K(ret));
@@ -723,7 +726,8 @@ int ObSSTableIndexBuilder::build_meta_tree(ObSSTableMergeRes &res)
         if (OB_ISNULL(macro_meta)) {
           ret = OB_ERR_UNEXPECTED;
           STORAGE_LOG(WARN, "unexpected null macro meta", K(ret), K(j), K(roots_.at(i)));
-        } else if (OB_FAIL(macro_meta->build_row(index_row_, self_allocator_))) {
+        } else if (FALSE_IT(row_allocator.reuse())) {
+        } else if (OB_FAIL(macro_meta->build_row(index_row_, row_allocator))) {
           STORAGE_LOG(WARN, "fail to build row of macro meta", K(ret), KPC(macro_meta));
         } else if (OB_FAIL(builder.append_leaf_row(index_row_))) {
           STORAGE_LOG(WARN, "fail to append leaf row", K(ret), K(index_row_));
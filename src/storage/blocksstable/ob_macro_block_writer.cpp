@@ -23,6 +23,8 @@
 #include "storage/blocksstable/ob_index_block_macro_iterator.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
 #include "storage/blocksstable/ob_macro_block_writer.h"
+#include "storage/blocksstable/ob_micro_block_compress_pipeline.h"
+#include "storage/compaction/ob_tenant_tablet_scheduler.h"
 #include "storage/ddl/ob_ddl_redo_log_writer.h"
 #include "storage/ob_i_store.h"
 #include "storage/ob_sstable_struct.h"
@@ -314,6 +316,13 @@ int ObMicroBlockAdaptiveSplitter::check_need_split(const int64_t micro_size,
   return ret;
 }
 
+bool ObMicroBlockAdaptiveSplitter::is_need_compression_info(const int64_t micro_size,
+                                                            const int64_t split_size) const
+{
+  return is_use_adaptive_ && micro_size >= split_size
+      && micro_size < ObIMicroBlockWriter::DEFAULT_MICRO_MAX_SIZE;
+}
+
 int ObMicroBlockAdaptiveSplitter::update_compression_info(const int64_t micro_row_count,
                                                           const int64_t original_size,
                                                           const int64_t compressed_size)
@@ -372,7 +381,9 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    datum_row_(),
    check_datum_row_(),
    callback_(nullptr),
-   builder_(NULL)
+   builder_(NULL),
+   compress_pipeline_(nullptr),
+   empty_micro_block_size_(0)
 {
   //macro_blocks_, macro_handles_
 }
@@ -384,6 +395,12 @@ ObMacroBlockWriter::~ObMacroBlockWriter()
 
 void ObMacroBlockWriter::reset()
 {
+  if (OB_NOT_NULL(compress_pipeline_)) {
+    // wait for the micro blocks in compressing, which reference the read info and store desc
+    compress_pipeline_->~ObMicroBlockCompressPipeline();
+    allocator_.free(compress_pipeline_);
+    compress_pipeline_ = nullptr;
+  }
   data_store_desc_ = nullptr;
   if (OB_NOT_NULL(micro_writer_)) {
     micro_writer_->~ObIMicroBlockWriter();
@@ -413,6 +430,7 @@ void ObMacroBlockWriter::reset()
     builder_ = nullptr;
   }
   micro_block_adaptive_splitter_.reset();
+  empty_micro_block_size_ = 0;
   allocator_.reset();
   rowkey_allocator_.reset();
 }
@@ -453,6 +471,7 @@ int ObMacroBlockWriter::open(
                                      micro_writer_,
                                      GCONF.micro_block_merge_verify_level))) {
         STORAGE_LOG(WARN, "fail to build micro writer", K(ret));
+      } else if (FALSE_IT(empty_micro_block_size_ = micro_writer_->get_block_size())) {
       } else if (OB_FAIL(read_info_.init(
                          allocator_,
                          data_store_desc.row_column_count_ - ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt(),
@@ -487,6 +506,9 @@ int ObMacroBlockWriter::open(
               sizeof(int64_t) * data_store_desc_->row_column_count_);
         }
       }
+      if (OB_SUCC(ret) && OB_FAIL(open_compress_pipeline())) {
+        STORAGE_LOG(WARN, "fail to open compress pipeline", K(ret));
+      }
     }
   }
   return ret;
@@ -571,6 +593,11 @@ int ObMacroBlockWriter::append_row(const ObDatumRow &row, const int64_t split_si
       if (OB_FAIL(ret)) {
       } else if (OB_FAIL(save_last_key(*row_to_append))) {
         STORAGE_LOG(WARN, "Fail to save last key, ", K(ret), K(row));
+      } else if (OB_NOT_NULL(compress_pipeline_) && !compress_pipeline_->is_empty()
+          && micro_block_adaptive_splitter_.is_need_compression_info(micro_writer_->get_block_size(), split_size)
+          && OB_FAIL(flush_compress_pipeline())) {
+        // the split decision must see all the micro blocks built before, as compressing inline does
+        STORAGE_LOG(WARN, "fail to flush compress pipeline", K(ret));
       } else if (OB_FAIL(micro_block_adaptive_splitter_.check_need_split(micro_writer_->get_block_size(), micro_writer_->get_row_count(),
             split_size, macro_blocks_[current_index_].get_data_size(), is_keep_freespace(), is_split))) {
         STORAGE_LOG(WARN, "Failed to check need split", K(ret), KPC(micro_writer_));
@@ -593,6 +620,8 @@ int ObMacroBlockWriter::append_macro_block(const ObMacroBlockDesc &macro_desc)
 
   if (OB_FAIL(ret)) {
     // skip
+  } else if (OB_FAIL(flush_compress_pipeline())) {
+    LOG_WARN("Fail to flush compress pipeline", K(ret));
   } else if (OB_FAIL(try_switch_macro_block())) {
     LOG_WARN("Fail to flush and switch macro block", K(ret));
   } else if (OB_UNLIKELY(!macro_desc.is_valid_with_macro_meta())
@@ -623,6 +652,7 @@ int ObMacroBlockWriter::append_macro_block(const ObMacroBlockDesc &macro_desc)
         data_store_desc_->merge_info_->multiplexed_macro_block_count_++;
         data_store_desc_->merge_info_->macro_block_count_++;
         data_store_desc_->merge_info_->total_row_count_ += macro_desc.row_count_;
+        data_store_desc_->merge_info_->multiplexed_row_count_ += macro_desc.row_count_;
         data_store_desc_->merge_info_->occupy_size_
             += static_cast<const ObDataMacroBlockMeta *>(data_block_meta)->val_.occupy_size_;
       }
@@ -652,6 +682,9 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block, cons
         STORAGE_LOG(WARN, "build_micro_block failed", K(ret));
       }
     }
+    if (OB_SUCC(ret) && OB_FAIL(flush_compress_pipeline())) {
+      STORAGE_LOG(WARN, "fail to flush compress pipeline", K(ret));
+    }
     if (OB_SUCC(ret)) {
       ObMicroBlockDesc micro_block_desc;
       ObMicroBlockHeader header_for_rewrite;
@@ -659,8 +692,12 @@ int ObMacroBlockWriter::append_micro_block(const ObMicroBlock &micro_block, cons
         STORAGE_LOG(WARN, "build_micro_block_desc failed", K(ret), K(micro_block));
       } else if (OB_FAIL(write_micro_block(micro_block_desc))) {
         STORAGE_LOG(WARN, "Failed to write micro block, ", K(ret), K(micro_block_desc));
-      } else if (NULL != data_store_desc_->merge_info_) {
-        data_store_desc_->merge_info_->multiplexed_micro_count_in_new_macro_++;
+      } else {
+        last_key_with_L_flag_ = false; // clear flag
+        if (NULL != data_store_desc_->merge_info_) {
+          data_store_desc_->merge_info_->multiplexed_micro_count_in_new_macro_++;
+          data_store_desc_->merge_info_->multiplexed_row_count_ += micro_block_desc.row_count_;
+        }
       }
     }
   } else {
@@ -700,7 +737,13 @@ int ObMacroBlockWriter::close()
     STORAGE_LOG(WARN, "exceptional situation", K(ret), K_(data_store_desc), K_(micro_writer));
   } else if (micro_writer_->get_row_count() > 0 && OB_FAIL(build_micro_block())) {
     STORAGE_LOG(WARN, "macro block writer fail to build current micro block.", K(ret));
+  } else if (OB_FAIL(flush_compress_pipeline())) {
+    STORAGE_LOG(WARN, "macro block writer fail to flush compress pipeline.", K(ret));
   } else {
+    if (OB_NOT_NULL(compress_pipeline_) && OB_NOT_NULL(data_store_desc_->merge_info_)) {
+      data_store_desc_->merge_info_->compress_time_ += compress_pipeline_->get_compress_time();
+      data_store_desc_->merge_info_->compress_wait_time_ += compress_pipeline_->get_wait_time();
+    }
     ObMacroBlock &current_block = macro_blocks_[current_index_];
     ObMacroBloomFilterCacheWriter &current_bf_writer = bf_cache_writer_[current_index_];
     if (OB_SUCC(ret) && current_block.is_dirty()) {
@@ -875,32 +918,108 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (FALSE_IT(micro_block_desc.last_rowkey_ = last_key_)) {
   } else if (FALSE_IT(block_size = micro_block_desc.buf_size_)) {
+  } else if (OB_NOT_NULL(compress_pipeline_)) {
+    // compress in the compress pool, the oldest micro block is written when the pipeline is full
+    if (compress_pipeline_->is_full() && OB_FAIL(write_compressed_micro_blocks(false/*wait_all*/))) {
+      STORAGE_LOG(WARN, "fail to write compressed micro block", K(ret));
+    } else if (OB_FAIL(compress_pipeline_->push(micro_block_desc, micro_rowkey_hashs_))) {
+      STORAGE_LOG(WARN, "fail to push micro block into compress pipeline", K(ret), K(micro_block_desc));
+    }
   } else if (OB_FAIL(micro_helper_.compress_encrypt_micro_block(micro_block_desc))) {
     micro_writer_->dump_diagnose_info(); // ignore dump error
     STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), K(micro_block_desc));
-  } else {
-    if (OB_FAIL(write_micro_block(micro_block_desc))) {
-      STORAGE_LOG(WARN, "fail to write micro block ", K(ret), K(micro_block_desc));
-    } else if (OB_FAIL(micro_block_adaptive_splitter_.update_compression_info(micro_block_desc.row_count_,
-       block_size, micro_block_desc.buf_size_))) {
-      STORAGE_LOG(WARN, "Fail to update_compression_info", K(ret), K(micro_block_desc));
-    }
+  } else if (OB_FAIL(write_compressed_micro_block(micro_block_desc, block_size, micro_rowkey_hashs_))) {
+    STORAGE_LOG(WARN, "fail to write compressed micro block", K(ret), K(micro_block_desc));
   }
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
     if (data_store_desc_->need_prebuild_bloomfilter_ && micro_rowkey_hashs_.count() > 0) {
       micro_rowkey_hashs_.reuse();
     }
-    if (OB_NOT_NULL(data_store_desc_->merge_info_)) {
-      data_store_desc_->merge_info_->original_size_ += block_size;
-      data_store_desc_->merge_info_->compressed_size_ += micro_block_desc.buf_size_;
-      data_store_desc_->merge_info_->new_micro_count_in_new_macro_++;
-    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
 }
 
+int ObMacroBlockWriter::write_compressed_micro_block(
+    ObMicroBlockDesc &micro_block_desc,
+    const int64_t block_size,
+    ObArray<uint32_t> &micro_rowkey_hashs)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(write_micro_block(micro_block_desc, micro_rowkey_hashs))) {
+    STORAGE_LOG(WARN, "fail to write micro block ", K(ret), K(micro_block_desc));
+  } else if (OB_FAIL(micro_block_adaptive_splitter_.update_compression_info(micro_block_desc.row_count_,
+     block_size, micro_block_desc.buf_size_))) {
+    STORAGE_LOG(WARN, "Fail to update_compression_info", K(ret), K(micro_block_desc));
+  } else if (OB_NOT_NULL(data_store_desc_->merge_info_)) {
+    data_store_desc_->merge_info_->original_size_ += block_size;
+    data_store_desc_->merge_info_->compressed_size_ += micro_block_desc.buf_size_;
+    data_store_desc_->merge_info_->new_micro_count_in_new_macro_++;
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::write_compressed_micro_blocks(const bool wait_all)
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockCompressTask *task = nullptr;
+  if (OB_ISNULL(compress_pipeline_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "compress pipeline is null", K(ret));
+  }
+  // write at least one micro block, all of them if wait_all
+  for (bool is_first = true; OB_SUCC(ret) && !compress_pipeline_->is_empty() && (is_first || wait_all);
+       is_first = false) {
+    if (OB_FAIL(compress_pipeline_->wait_first(task))) {
+      STORAGE_LOG(WARN, "fail to wait compress task", K(ret));
+    } else if (OB_FAIL(task->get_ret())) {
+      STORAGE_LOG(WARN, "failed to compress and encrypt micro block", K(ret), KPC(task));
+    } else if (OB_FAIL(write_compressed_micro_block(task->get_micro_block_desc(),
+                                                    task->get_original_block_size(),
+                                                    task->get_micro_rowkey_hashs()))) {
+      STORAGE_LOG(WARN, "fail to write compressed micro block", K(ret), KPC(task));
+    } else if (OB_FAIL(compress_pipeline_->pop())) {
+      STORAGE_LOG(WARN, "fail to pop compress task", K(ret));
+    } else if (OB_FAIL(after_compressed_micro_block_written())) {
+      STORAGE_LOG(WARN, "fail to handle written micro block", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::flush_compress_pipeline()
+{
+  int ret = OB_SUCCESS;
+  if (OB_NOT_NULL(compress_pipeline_) && OB_FAIL(write_compressed_micro_blocks(true/*wait_all*/))) {
+    STORAGE_LOG(WARN, "fail to write compressed micro blocks", K(ret));
+  }
+  return ret;
+}
+
+int ObMacroBlockWriter::open_compress_pipeline()
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockCompressPool *compress_pool = MTL(ObMicroBlockCompressPool *);
+  int64_t thread_cnt = 0;
+  // only the data micro blocks of compaction are compressed in background
+  if (OB_ISNULL(data_store_desc_->merge_info_) || OB_ISNULL(builder_) || OB_ISNULL(compress_pool)) {
+  } else if (0 >= (thread_cnt = compress_pool->get_thread_cnt())) {
+  } else if (OB_ISNULL(compress_pipeline_ = OB_NEWx(ObMicroBlockCompressPipeline, &allocator_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    STORAGE_LOG(WARN, "fail to alloc compress pipeline", K(ret));
+  } else if (OB_FAIL(compress_pipeline_->init(*data_store_desc_, read_info_, *compress_pool,
+      MIN(thread_cnt + 1, ObMicroBlockCompressPipeline::MAX_TASK_CNT)))) {
+    STORAGE_LOG(WARN, "fail to init compress pipeline", K(ret), K(thread_cnt));
+  }
+  if (OB_FAIL(ret) && OB_NOT_NULL(compress_pipeline_)) {
+    compress_pipeline_->~ObMicroBlockCompressPipeline();
+    allocator_.free(compress_pipeline_);
+    compress_pipeline_ = nullptr;
+  }
+  return ret;
+}
+
 int ObMacroBlockWriter::build_micro_block_desc(
     const ObMicroBlock &micro_block,
     ObMicroBlockDesc &micro_block_desc,
@@ -913,6 +1032,11 @@ int ObMacroBlockWriter::build_micro_block_desc(
   } else if (OB_UNLIKELY(!micro_block.header_.is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("expect valid micro header", K(ret), K(micro_block.header_));
+  } else if (!data_store_desc_->is_major_merge()) {
+    // minor sstable has no column checksum, the micro block is reused as it is
+    if (OB_FAIL(build_micro_block_desc_with_reuse(micro_block, micro_block_desc))) {
+      LOG_WARN("fail to build micro block desc for minor", K(ret), K(micro_block), K(micro_block_desc));
+    }
   } else if (micro_block.header_.has_column_checksum_
       && micro_block.micro_index_info_->row_header_->get_schema_version() == data_store_desc_->schema_version_) {
     if (OB_FAIL(build_micro_block_desc_with_reuse(micro_block, micro_block_desc))) {
@@ -947,6 +1071,13 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.buf_size_ = header.data_zlength_;
     micro_block_desc.has_out_row_column_ = micro_block.micro_index_info_->has_out_row_column();
     micro_block_desc.original_size_ = header.original_length_;
+    if (!data_store_desc_->is_major_merge()) {
+      // multi-version info of the minor micro block, kept in the flat header
+      micro_block_desc.max_merged_trans_version_ = header.max_merged_trans_version_;
+      micro_block_desc.contain_uncommitted_row_ = header.contain_uncommitted_rows();
+      micro_block_desc.is_last_row_last_flag_ = header.is_last_row_last_flag();
+      micro_block_desc.row_count_delta_ = static_cast<int32_t>(micro_block.micro_index_info_->get_row_count_delta());
+    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
@@ -958,12 +1089,13 @@ int ObMacroBlockWriter::build_micro_block_desc_with_rewrite(
     ObMicroBlockHeader &header)
 {
   int ret = OB_SUCCESS;
-  ObIMicroBlockReader *reader = NULL;
-  ObMicroBlockData decompressed_data;
-  const bool deep_copy_des_meta = false;
-  ObMicroBlockDesMeta micro_des_meta;
   header = micro_block.header_;
-  ObRowStoreType row_store_type = static_cast<ObRowStoreType>(header.row_store_type_);
+  // the schema changed without adding columns, the column checksums of the micro block are
+  // still valid since the data is not touched, no need to decode all rows again.
+  const bool reuse_column_checksum = data_store_desc_->is_major_merge()
+      && header.has_column_checksum_
+      && NULL != header.column_checksums_
+      && header.column_count_ == data_store_desc_->row_column_count_;
 
   if (OB_UNLIKELY(!micro_block.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
@@ -971,54 +1103,46 @@ int ObMacroBlockWriter::build_micro_block_desc_with_rewrite(
   } else if (OB_UNLIKELY(!header.is_valid())) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("expect valid micro header", K(ret), K(header));
-  } else if (OB_FAIL(reader_helper_.get_reader(row_store_type, reader))) {
-    LOG_WARN("fail to get reader", K(ret), K(micro_block));
-  } else if (OB_ISNULL(reader)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("reader is null", K(ret), KP(reader));
-  } else if (OB_FAIL(micro_block.micro_index_info_->row_header_->fill_micro_des_meta(
-      deep_copy_des_meta, micro_des_meta))) {
-    LOG_WARN("fail to fill micro block deserialize meta", K(ret), KPC(micro_block.micro_index_info_));
+  } else if (!data_store_desc_->is_major_merge()) {
+  } else if (reuse_column_checksum) {
+    MEMCPY(curr_micro_column_checksum_, header.column_checksums_, sizeof(int64_t) * header.column_count_);
+  } else if (OB_FAIL(calc_micro_column_checksum(micro_block, data_store_desc_->row_column_count_))) {
+    LOG_WARN("fail to calc micro block column checksum", K(ret), K(micro_block));
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(save_last_key(micro_block.range_.get_end_key()))) {
+    LOG_WARN("Fail to save last key, ", K(ret), K(micro_block.range_.get_end_key()));
   } else {
-    bool is_compressed = false;
-    reader->reset();
+    micro_block_desc.header_ = &header;
+    micro_block_desc.buf_ = micro_block.payload_data_.get_buf() + header.header_size_; // get original data_buf
+    micro_block_desc.buf_size_ = header.data_zlength_;
+    // rewrite column_count, column_checksum, and header_size
+    header.column_count_ = data_store_desc_->row_column_count_;
+    header.has_column_checksum_ = data_store_desc_->is_major_merge();
+    header.column_checksums_ = header.has_column_checksum_ ? curr_micro_column_checksum_ : NULL;
+    header.header_size_ = header.get_serialize_size();
 
-    if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(micro_des_meta, micro_block.data_.get_buf(),
-        micro_block.data_.get_buf_size(), decompressed_data.get_buf(), decompressed_data.get_buf_size(), is_compressed))) {
-      LOG_WARN("fail to decrypt and decompress data", K(ret));
-    } else if (OB_FAIL(reader->init(decompressed_data, *micro_block.read_info_))) {
-      LOG_WARN("reader init failed", K(micro_block), K(ret));
-    } else if (OB_FAIL(save_last_key(micro_block.range_.get_end_key()))) {
-      LOG_WARN("Fail to save last key, ", K(ret), K(micro_block.range_.get_end_key()));
-    } else {
-      micro_block_desc.header_ = &header;
-      micro_block_desc.buf_ = micro_block.payload_data_.get_buf() + header.header_size_; // get original data_buf
-      micro_block_desc.buf_size_ = header.data_zlength_;
-      // rewrite column_count, column_checksum, and header_size
-      header.column_count_ = data_store_desc_->row_column_count_;
-      header.has_column_checksum_ = data_store_desc_->is_major_merge();
-      header.column_checksums_ = header.has_column_checksum_ ? curr_micro_column_checksum_ : NULL;
-      header.header_size_ = header.get_serialize_size();
-
-      micro_block_desc.last_rowkey_ = micro_block.range_.get_end_key();
-      micro_block_desc.data_size_ = header.data_length_;
-      micro_block_desc.original_size_ = header.original_length_;
-      micro_block_desc.column_count_ = header.column_count_;
-      micro_block_desc.row_count_ = header.row_count_;
-      micro_block_desc.has_out_row_column_ = micro_block.micro_index_info_->has_out_row_column();
-      if (header.has_column_checksum_) {
-        MEMSET(curr_micro_column_checksum_, 0, sizeof(int64_t) * data_store_desc_->row_column_count_);
-        if (OB_FAIL(calc_micro_column_checksum(header.column_count_, *reader, curr_micro_column_checksum_))) {
-          STORAGE_LOG(WARN, "fail to calc micro block column checksum", K(ret));
-        }
-      }
-    }
+    micro_block_desc.last_rowkey_ = micro_block.range_.get_end_key();
+    micro_block_desc.data_size_ = header.data_length_;
+    micro_block_desc.original_size_ = header.original_length_;
+    micro_block_desc.column_count_ = header.column_count_;
+    micro_block_desc.row_count_ = header.row_count_;
+    micro_block_desc.has_out_row_column_ = micro_block.micro_index_info_->has_out_row_column();
   }
-  STORAGE_LOG(DEBUG, "build micro block desc rewrite", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
+  STORAGE_LOG(DEBUG, "build micro block desc rewrite", K(data_store_desc_->tablet_id_), K(micro_block_desc),
+      K(reuse_column_checksum), "lbt", lbt(), K(ret));
   return ret;
 }
 
 int ObMacroBlockWriter::write_micro_block(ObMicroBlockDesc &micro_block_desc)
+{
+  return write_micro_block(micro_block_desc, micro_rowkey_hashs_);
+}
+
+int ObMacroBlockWriter::write_micro_block(
+    ObMicroBlockDesc &micro_block_desc,
+    ObArray<uint32_t> &micro_rowkey_hashs)
 {
   int ret = OB_SUCCESS;
   int64_t data_offset = 0;
@@ -1086,22 +1210,22 @@ int ObMacroBlockWriter::write_micro_block(ObMicroBlockDesc &micro_block_desc)
           ret = OB_SUCCESS;
         }
       }
-      if (micro_rowkey_hashs_.count() != micro_block_desc.row_count_) {
-        //count=0 ,when micro block reused
-        if(OB_UNLIKELY(micro_rowkey_hashs_.count() > 0)) {
-          STORAGE_LOG(WARN,"build bloomfilter: micro_rowkey_hashs_ and micro_block_desc count not same ",
-                      K(micro_rowkey_hashs_.count()),
+      if (micro_rowkey_hashs.count() != micro_block_desc.row_count_) {
+        //count=0 ,when micro block reused, the bloomfilter of the macro block would be incomplete
+        if(OB_UNLIKELY(micro_rowkey_hashs.count() > 0)) {
+          STORAGE_LOG(WARN,"build bloomfilter: micro_rowkey_hashs and micro_block_desc count not same ",
+                      "micro_rowkey_hashs count", micro_rowkey_hashs.count(),
                       K(micro_block_desc.row_count_));
         }
         current_writer.set_not_need_build();
       } else if (current_writer.is_need_build()
                  && OB_LIKELY(current_writer.get_rowkey_column_count() == data_store_desc_->bloomfilter_rowkey_prefix_)
-                 && OB_FAIL(current_writer.append(micro_rowkey_hashs_))) {
+                 && OB_FAIL(current_writer.append(micro_rowkey_hashs))) {
         STORAGE_LOG(WARN, "Fail to append rowkey hash to macro block, ", K(ret));
         current_writer.set_not_need_build();
         ret = OB_SUCCESS;
       }
-      micro_rowkey_hashs_.reuse();
+      micro_rowkey_hashs.reuse();
     }
   }
 
@@ -1118,6 +1242,7 @@ int ObMacroBlockWriter::flush_macro_block(ObMacroBlock &macro_block)
 
   ObMacroBlockHandle &macro_handle = macro_handles_[current_index_];
   ObMacroBlockHandle &prev_handle = macro_handles_[(current_index_ + 1) % 2];
+  ObTenantTabletScheduler *tablet_scheduler = nullptr;
 
   if (OB_UNLIKELY(!macro_block.is_dirty())) {
     ret = OB_ERR_UNEXPECTED;
@@ -1129,6 +1254,10 @@ int ObMacroBlockWriter::flush_macro_block(ObMacroBlock &macro_block)
   } else if (OB_NOT_NULL(builder_)
       && OB_FAIL(builder_->generate_macro_row(macro_block, macro_handle.get_macro_id()))) {
     STORAGE_LOG(WARN, "fail to generate macro row", K(ret), K_(current_macro_seq));
+  } else if (OB_NOT_NULL(data_store_desc_->merge_info_)
+      && OB_NOT_NULL(tablet_scheduler = MTL(ObTenantTabletScheduler *))
+      && FALSE_IT(tablet_scheduler->get_compaction_throttle().throttle_write(
+                  data_store_desc_->merge_type_, macro_block.get_data_size()))) {
   } else if (OB_FAIL(macro_block.flush(macro_handle, block_write_ctx_))) {
     STORAGE_LOG(WARN, "macro block writer fail to flush macro block.", K(ret));
   } else if (OB_NOT_NULL(callback_) && OB_FAIL(callback_->write(macro_handle,
@@ -1258,6 +1387,11 @@ int ObMacroBlockWriter::check_micro_block_need_merge(
   if (!micro_block.is_valid()) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid micro_block", K(micro_block), K(ret));
+  } else if (!data_store_desc_->is_major_merge()
+      && (FLAT_ROW_STORE != micro_block.header_.row_store_type_
+          || micro_block.header_.column_count_ != data_store_desc_->row_column_count_)) {
+    // minor micro block can only be reused as it is, the rows should be rewritten
+    need_merge = true;
   } else {
     if (micro_writer_->get_row_count() <= 0
         && micro_block.header_.data_length_ > data_store_desc_->micro_block_size_ / 2) {
@@ -1362,6 +1496,38 @@ int ObMacroBlockWriter::save_last_key(const ObDatumRowkey &last_key)
   return ret;
 }
 
+int ObMacroBlockWriter::calc_micro_column_checksum(const ObMicroBlock &micro_block, const int64_t column_cnt)
+{
+  int ret = OB_SUCCESS;
+  ObIMicroBlockReader *reader = NULL;
+  ObMicroBlockData decompressed_data;
+  const bool deep_copy_des_meta = false;
+  ObMicroBlockDesMeta micro_des_meta;
+  bool is_compressed = false;
+  const ObRowStoreType row_store_type = static_cast<ObRowStoreType>(micro_block.header_.row_store_type_);
+  if (OB_FAIL(reader_helper_.get_reader(row_store_type, reader))) {
+    LOG_WARN("fail to get reader", K(ret), K(micro_block));
+  } else if (OB_ISNULL(reader)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("reader is null", K(ret), KP(reader));
+  } else if (OB_FAIL(micro_block.micro_index_info_->row_header_->fill_micro_des_meta(
+      deep_copy_des_meta, micro_des_meta))) {
+    LOG_WARN("fail to fill micro block deserialize meta", K(ret), KPC(micro_block.micro_index_info_));
+  } else if (FALSE_IT(reader->reset())) {
+  } else if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(micro_des_meta, micro_block.data_.get_buf(),
+      micro_block.data_.get_buf_size(), decompressed_data.get_buf(), decompressed_data.get_buf_size(), is_compressed))) {
+    LOG_WARN("fail to decrypt and decompress data", K(ret));
+  } else if (OB_FAIL(reader->init(decompressed_data, *micro_block.read_info_))) {
+    LOG_WARN("reader init failed", K(micro_block), K(ret));
+  } else {
+    MEMSET(curr_micro_column_checksum_, 0, sizeof(int64_t) * column_cnt);
+    if (OB_FAIL(calc_micro_column_checksum(column_cnt, *reader, curr_micro_column_checksum_))) {
+      STORAGE_LOG(WARN, "fail to calc micro block column checksum", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObMacroBlockWriter::calc_micro_column_checksum(const int64_t column_cnt,
                                                    ObIMicroBlockReader &reader,
                                                    int64_t *column_checksum)
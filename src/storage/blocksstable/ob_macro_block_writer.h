@@ -40,6 +40,7 @@ class ObSSTableSecMetaIterator;
 struct ObIndexBlockRowDesc;
 struct ObMacroBlockDesc;
 class ObIMacroBlockFlushCallback;
+class ObMicroBlockCompressPipeline;
 // macro block store struct
 //  |- ObMacroBlockCommonHeader
 //  |- ObSSTableMacroBlockHeader
@@ -112,6 +113,8 @@ public:
                        const int64_t current_macro_size,
                        const bool is_keep_space,
                        bool &check_need_split) const;
+  // whether check_need_split() reads the compression info and the current macro size
+  bool is_need_compression_info(const int64_t micro_size, const int64_t split_size) const;
 int update_compression_info(const int64_t micro_row_count, const int64_t original_size, const int64_t compressed_size);
 private:
   static const int64_t DEFAULT_MICRO_ROW_COUNT = 16;
@@ -138,6 +141,7 @@ public:
   virtual int append_row(const ObDatumRow &row, const ObMacroBlockDesc *curr_macro_desc = nullptr);
   int append_index_micro_block(ObMicroBlockDesc &micro_block_desc);
   int check_data_macro_block_need_merge(const ObMacroBlockDesc &macro_desc, bool &need_merge);
+  int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
   int close();
   void dump_block_and_writer_buffer();
   inline ObMacroBlocksWriteCtx &get_macro_block_write_ctx() { return block_write_ctx_; }
@@ -155,6 +159,14 @@ protected:
   inline bool is_dirty() const { return macro_blocks_[current_index_].is_dirty() || 0 != micro_writer_->get_row_count(); }
   inline int64_t get_curr_micro_writer_row_count() const { return micro_writer_->get_row_count(); }
   inline int64_t get_macro_data_size() const { return macro_blocks_[current_index_].get_data_size() + micro_writer_->get_block_size(); }
+  // macro data size right after a micro block is written, the micro writer may already
+  // have rows of the next micro block when it is written from the compress pipeline
+  inline int64_t get_written_macro_data_size() const { return macro_blocks_[current_index_].get_data_size() + empty_micro_block_size_; }
+  // write all the micro blocks in the compress pipeline into the macro block
+  int flush_compress_pipeline();
+  // called after a micro block of the compress pipeline is written, to make the same
+  // decisions as build_micro_block() makes after writing a micro block inline
+  virtual int after_compressed_micro_block_written() { return common::OB_SUCCESS; }
 
 private:
   int append_row(const ObDatumRow &row, const int64_t split_size);
@@ -169,7 +181,15 @@ private:
       ObMicroBlockHeader &header);
   int build_micro_block_desc_with_reuse(const ObMicroBlock &micro_block, ObMicroBlockDesc &micro_block_desc);
   int write_micro_block(ObMicroBlockDesc &micro_block_desc);
-  int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
+  int write_micro_block(
+      ObMicroBlockDesc &micro_block_desc,
+      common::ObArray<uint32_t> &micro_rowkey_hashs);
+  int open_compress_pipeline();
+  int write_compressed_micro_block(
+      ObMicroBlockDesc &micro_block_desc,
+      const int64_t block_size,
+      common::ObArray<uint32_t> &micro_rowkey_hashs);
+  int write_compressed_micro_blocks(const bool wait_all);
   int merge_micro_block(const ObMicroBlock &micro_block);
   int flush_macro_block(ObMacroBlock &macro_block);
   int wait_io_finish(ObMacroBlockHandle &macro_handle);
@@ -182,6 +202,8 @@ private:
       const int64_t column_cnt,
       ObIMicroBlockReader &reader,
       int64_t *column_checksum);
+  // decode the rows of the micro block to calc column checksum into curr_micro_column_checksum_
+  int calc_micro_column_checksum(const ObMicroBlock &micro_block, const int64_t column_cnt);
   int flush_reuse_macro_block(const ObDataMacroBlockMeta &macro_meta);
   int open_bf_cache_writer(const ObDataStoreDesc &desc, const int64_t bloomfilter_size);
   int flush_bf_to_cache(ObMacroBloomFilterCacheWriter &bf_cache_writer, const int32_t row_count);
@@ -221,6 +243,8 @@ private:
   ObIMacroBlockFlushCallback *callback_;
   ObDataIndexBlockBuilder *builder_;
   ObMicroBlockAdaptiveSplitter micro_block_adaptive_splitter_;
+  ObMicroBlockCompressPipeline *compress_pipeline_;
+  int64_t empty_micro_block_size_;
 };
 
 }//end namespace blocksstable
@@ -0,0 +1,504 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "storage/blocksstable/ob_micro_block_compress_pipeline.h"
+#include "lib/thread/thread_mgr.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+/**
+ * ---------------------------------------------------------ObMicroBlockCompressTask--------------------------------------------------------------
+ */
+ObMicroBlockCompressTask::ObMicroBlockCompressTask()
+  : pipeline_(nullptr),
+    helper_(),
+    micro_block_desc_(),
+    header_(),
+    column_checksums_(nullptr),
+    column_checksum_cnt_(0),
+    buf_(nullptr),
+    buf_capacity_(0),
+    original_block_size_(0),
+    micro_rowkey_hashs_(),
+    allocator_("MicroCompress", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+    rowkey_allocator_("MicroCompress", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
+    status_(IDLE),
+    ret_(OB_SUCCESS),
+    compress_time_(0)
+{
+}
+
+ObMicroBlockCompressTask::~ObMicroBlockCompressTask()
+{
+  reset();
+}
+
+int ObMicroBlockCompressTask::init(
+    ObMicroBlockCompressPipeline &pipeline,
+    ObDataStoreDesc &data_store_desc,
+    ObTableReadInfo &read_info)
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_FAIL(helper_.open(data_store_desc, read_info, allocator_))) {
+    LOG_WARN("fail to open micro block buffer helper", K(ret));
+  } else {
+    pipeline_ = &pipeline;
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressTask::reset()
+{
+  pipeline_ = nullptr;
+  helper_.reset();
+  micro_block_desc_.reset();
+  header_.reset();
+  column_checksums_ = nullptr;
+  column_checksum_cnt_ = 0;
+  if (OB_NOT_NULL(buf_)) {
+    ob_free(buf_);
+    buf_ = nullptr;
+  }
+  buf_capacity_ = 0;
+  original_block_size_ = 0;
+  micro_rowkey_hashs_.reset();
+  allocator_.reset();
+  rowkey_allocator_.reset();
+  status_ = IDLE;
+  ret_ = OB_SUCCESS;
+  compress_time_ = 0;
+}
+
+void ObMicroBlockCompressTask::reuse()
+{
+  micro_block_desc_.reset();
+  header_.reset();
+  original_block_size_ = 0;
+  micro_rowkey_hashs_.reuse();
+  rowkey_allocator_.reuse();
+  status_ = IDLE;
+  ret_ = OB_SUCCESS;
+  compress_time_ = 0;
+}
+
+int ObMicroBlockCompressTask::fill(
+    const ObMicroBlockDesc &micro_block_desc,
+    const ObIArray<uint32_t> &micro_rowkey_hashs)
+{
+  int ret = OB_SUCCESS;
+  const ObMicroBlockHeader *header = micro_block_desc.header_;
+  const int64_t buf_size = micro_block_desc.buf_size_;
+  if (OB_UNLIKELY(!micro_block_desc.is_valid() || OB_ISNULL(header))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid micro block desc", K(ret), K(micro_block_desc));
+  } else if (OB_UNLIKELY(IDLE != status_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("compress task is in use", K(ret), KPC(this));
+  } else if (header->has_column_checksum_ && column_checksum_cnt_ < header->column_count_) {
+    if (OB_ISNULL(column_checksums_ = static_cast<int64_t *>(
+                  allocator_.alloc(sizeof(int64_t) * header->column_count_)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc column checksums", K(ret), K(header->column_count_));
+    } else {
+      column_checksum_cnt_ = header->column_count_;
+    }
+  }
+  if (OB_SUCC(ret) && buf_capacity_ < buf_size) {
+    char *new_buf = nullptr;
+    if (OB_ISNULL(new_buf = static_cast<char *>(ob_malloc(buf_size, ObMemAttr(MTL_ID(), "MicroCompress"))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc micro block buffer", K(ret), K(buf_size));
+    } else {
+      if (OB_NOT_NULL(buf_)) {
+        ob_free(buf_);
+      }
+      buf_ = new_buf;
+      buf_capacity_ = buf_size;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(micro_rowkey_hashs_.assign(micro_rowkey_hashs))) {
+    LOG_WARN("fail to copy micro rowkey hashs", K(ret));
+  } else {
+    micro_block_desc_ = micro_block_desc;
+    micro_block_desc_.last_rowkey_.reset();
+    if (OB_FAIL(micro_block_desc.last_rowkey_.deep_copy(micro_block_desc_.last_rowkey_, rowkey_allocator_))) {
+      LOG_WARN("fail to deep copy last rowkey", K(ret), K(micro_block_desc.last_rowkey_));
+    } else {
+      header_ = *header;
+      if (header_.has_column_checksum_) {
+        MEMCPY(column_checksums_, header->column_checksums_, sizeof(int64_t) * header->column_count_);
+        header_.column_checksums_ = column_checksums_;
+      }
+      MEMCPY(buf_, micro_block_desc.buf_, buf_size);
+      micro_block_desc_.header_ = &header_;
+      micro_block_desc_.buf_ = buf_;
+      original_block_size_ = buf_size;
+      ret_ = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressTask::process()
+{
+  int ret = OB_SUCCESS;
+  const int64_t start_ts = ObTimeUtility::fast_current_time();
+  if (OB_FAIL(helper_.compress_encrypt_micro_block(micro_block_desc_))) {
+    LOG_WARN("fail to compress and encrypt micro block", K(ret), K_(micro_block_desc));
+  }
+  ret_ = ret;
+  compress_time_ = ObTimeUtility::fast_current_time() - start_ts;
+  if (OB_NOT_NULL(pipeline_)) {
+    pipeline_->on_task_done(*this);
+  }
+}
+
+/**
+ * ---------------------------------------------------------ObMicroBlockCompressPool--------------------------------------------------------------
+ */
+ObMicroBlockCompressPool::ObMicroBlockCompressPool()
+  : is_inited_(false),
+    has_stopped_(false),
+    tg_id_(-1),
+    thread_cnt_(0),
+    last_refresh_ts_(0),
+    lock_()
+{
+}
+
+ObMicroBlockCompressPool::~ObMicroBlockCompressPool()
+{
+  destroy();
+}
+
+int ObMicroBlockCompressPool::mtl_init(ObMicroBlockCompressPool *&compress_pool)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(compress_pool)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("compress pool is null", K(ret));
+  } else if (OB_FAIL(compress_pool->init())) {
+    LOG_WARN("fail to init compress pool", K(ret));
+  }
+  return ret;
+}
+
+int ObMicroBlockCompressPool::init()
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(TG_CREATE_TENANT(lib::TGDefIDs::MicroBlockCompress, tg_id_))) {
+    LOG_WARN("fail to create micro block compress thread group", K(ret));
+  } else {
+    has_stopped_ = false;
+    thread_cnt_ = 0;
+    last_refresh_ts_ = 0;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObMicroBlockCompressPool::start()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(TG_SET_HANDLER_AND_START(tg_id_, *this))) {
+    LOG_WARN("fail to start micro block compress thread group", K(ret), K_(tg_id));
+  } else {
+    refresh_config();
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPool::stop()
+{
+  if (IS_INIT) {
+    TG_STOP(tg_id_);
+  }
+}
+
+void ObMicroBlockCompressPool::wait()
+{
+  if (IS_INIT) {
+    TG_WAIT(tg_id_);
+    // the queued tasks are dropped, they are compressed by the pipelines themselves
+    ATOMIC_STORE(&has_stopped_, true);
+  }
+}
+
+void ObMicroBlockCompressPool::destroy()
+{
+  if (IS_INIT) {
+    TG_DESTROY(tg_id_);
+    tg_id_ = -1;
+    thread_cnt_ = 0;
+    is_inited_ = false;
+  }
+}
+
+void ObMicroBlockCompressPool::refresh_config()
+{
+  const int64_t cur_ts = ObTimeUtility::fast_current_time();
+  if (cur_ts - ATOMIC_LOAD(&last_refresh_ts_) > REFRESH_CONFIG_INTERVAL) {
+    ObSpinLockGuard guard(lock_);
+    if (cur_ts - last_refresh_ts_ > REFRESH_CONFIG_INTERVAL) {
+      int tmp_ret = OB_SUCCESS;
+      int64_t thread_cnt = 0;
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+      if (tenant_config.is_valid()) {
+        thread_cnt = MIN(tenant_config->_micro_block_compress_thread_count, MAX_THREAD_CNT);
+      }
+      if (thread_cnt > 0 && thread_cnt != thread_cnt_) {
+        if (OB_SUCCESS != (tmp_ret = TG_SET_THREAD_CNT(tg_id_, thread_cnt))) {
+          LOG_WARN("fail to set micro block compress thread count", K(tmp_ret), K(thread_cnt));
+          thread_cnt = thread_cnt_;
+        } else {
+          LOG_INFO("micro block compress thread count changed", "old_cnt", thread_cnt_, K(thread_cnt));
+        }
+      }
+      ATOMIC_STORE(&thread_cnt_, thread_cnt);
+      ATOMIC_STORE(&last_refresh_ts_, cur_ts);
+    }
+  }
+}
+
+int64_t ObMicroBlockCompressPool::get_thread_cnt()
+{
+  int64_t thread_cnt = 0;
+  if (IS_INIT) {
+    refresh_config();
+    thread_cnt = ATOMIC_LOAD(&thread_cnt_);
+  }
+  return thread_cnt;
+}
+
+int ObMicroBlockCompressPool::push_task(ObMicroBlockCompressTask &task)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (has_stopped()) {
+    ret = OB_IN_STOP_STATE;
+  } else if (OB_FAIL(TG_PUSH_TASK(tg_id_, &task))) {
+    if (OB_EAGAIN != ret && OB_SIZE_OVERFLOW != ret) {
+      LOG_WARN("fail to push micro block compress task", K(ret), K_(tg_id));
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPool::handle(void *task)
+{
+  if (OB_ISNULL(task)) {
+    LOG_ERROR("micro block compress task is null", KP(task));
+  } else {
+    static_cast<ObMicroBlockCompressTask *>(task)->process();
+  }
+}
+
+/**
+ * ---------------------------------------------------------ObMicroBlockCompressPipeline--------------------------------------------------------------
+ */
+ObMicroBlockCompressPipeline::ObMicroBlockCompressPipeline()
+  : is_inited_(false),
+    compress_pool_(nullptr),
+    tasks_(),
+    task_cnt_(0),
+    head_(0),
+    tail_(0),
+    pending_size_(0),
+    compress_time_(0),
+    wait_time_(0),
+    cond_()
+{
+  MEMSET(tasks_, 0, sizeof(tasks_));
+}
+
+ObMicroBlockCompressPipeline::~ObMicroBlockCompressPipeline()
+{
+  reset();
+}
+
+int ObMicroBlockCompressPipeline::init(
+    ObDataStoreDesc &data_store_desc,
+    ObTableReadInfo &read_info,
+    ObMicroBlockCompressPool &compress_pool,
+    const int64_t task_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_UNLIKELY(task_cnt <= 0 || task_cnt > MAX_TASK_CNT)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid task count", K(ret), K(task_cnt));
+  } else if (OB_FAIL(cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
+    LOG_WARN("fail to init thread cond", K(ret));
+  } else {
+    // set before the tasks are created, so that reset() can free them on failure
+    is_inited_ = true;
+    for (int64_t i = 0; OB_SUCC(ret) && i < task_cnt; ++i) {
+      if (OB_ISNULL(tasks_[i] = OB_NEW(ObMicroBlockCompressTask, ObMemAttr(MTL_ID(), "MicroCompress")))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to alloc compress task", K(ret), K(i));
+      } else if (OB_FAIL(tasks_[i]->init(*this, data_store_desc, read_info))) {
+        LOG_WARN("fail to init compress task", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      compress_pool_ = &compress_pool;
+      task_cnt_ = task_cnt;
+    } else {
+      reset();
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPipeline::reset()
+{
+  if (IS_INIT) {
+    // tasks may still be referenced by the compress pool
+    for (int64_t seq = head_; seq < tail_; ++seq) {
+      wait_task(*tasks_[seq % task_cnt_]);
+    }
+    for (int64_t i = 0; i < MAX_TASK_CNT; ++i) {
+      if (OB_NOT_NULL(tasks_[i])) {
+        common::ob_delete(tasks_[i]);
+        tasks_[i] = nullptr;
+      }
+    }
+    cond_.destroy();
+    compress_pool_ = nullptr;
+    task_cnt_ = 0;
+    head_ = 0;
+    tail_ = 0;
+    pending_size_ = 0;
+    compress_time_ = 0;
+    wait_time_ = 0;
+    is_inited_ = false;
+  }
+}
+
+int ObMicroBlockCompressPipeline::push(
+    const ObMicroBlockDesc &micro_block_desc,
+    const ObIArray<uint32_t> &micro_rowkey_hashs)
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockCompressTask *task = nullptr;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(is_full())) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("compress pipeline is full", K(ret), KPC(this));
+  } else if (FALSE_IT(task = tasks_[tail_ % task_cnt_])) {
+  } else if (OB_FAIL(task->fill(micro_block_desc, micro_rowkey_hashs))) {
+    LOG_WARN("fail to fill compress task", K(ret));
+  } else {
+    ATOMIC_STORE(&task->status_, ObMicroBlockCompressTask::COMPRESSING);
+    ++tail_;
+    pending_size_ += task->get_original_block_size();
+    if (OB_FAIL(compress_pool_->push_task(*task))) {
+      // the queue of the pool is full, compress in current thread
+      ret = OB_SUCCESS;
+      task->process();
+    }
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPipeline::wait_task(ObMicroBlockCompressTask &task)
+{
+  bool need_process = false;
+  {
+    ObThreadCondGuard guard(cond_);
+    while (!need_process && ObMicroBlockCompressTask::DONE != ATOMIC_LOAD(&task.status_)) {
+      if (compress_pool_->has_stopped()) {
+        // the task will never be run by the stopped pool
+        need_process = true;
+      } else {
+        cond_.wait_us(WAIT_INTERVAL_US);
+      }
+    }
+  }
+  if (need_process) {
+    task.process();
+  }
+}
+
+int ObMicroBlockCompressPipeline::wait_first(ObMicroBlockCompressTask *&task)
+{
+  int ret = OB_SUCCESS;
+  task = nullptr;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(is_empty())) {
+    ret = OB_ENTRY_NOT_EXIST;
+    LOG_WARN("compress pipeline is empty", K(ret), KPC(this));
+  } else {
+    const int64_t start_ts = ObTimeUtility::fast_current_time();
+    task = tasks_[head_ % task_cnt_];
+    wait_task(*task);
+    wait_time_ += ObTimeUtility::fast_current_time() - start_ts;
+    compress_time_ += task->compress_time_;
+  }
+  return ret;
+}
+
+int ObMicroBlockCompressPipeline::pop()
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockCompressTask *task = nullptr;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(is_empty())) {
+    ret = OB_ENTRY_NOT_EXIST;
+    LOG_WARN("compress pipeline is empty", K(ret), KPC(this));
+  } else if (FALSE_IT(task = tasks_[head_ % task_cnt_])) {
+  } else if (OB_UNLIKELY(ObMicroBlockCompressTask::DONE != ATOMIC_LOAD(&task->status_))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("pop task not compressed", K(ret), KPC(task));
+  } else {
+    pending_size_ -= task->get_original_block_size();
+    task->reuse();
+    ++head_;
+  }
+  return ret;
+}
+
+void ObMicroBlockCompressPipeline::on_task_done(ObMicroBlockCompressTask &task)
+{
+  ObThreadCondGuard guard(cond_);
+  ATOMIC_STORE(&task.status_, ObMicroBlockCompressTask::DONE);
+  cond_.broadcast();
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_BLOCKSSTABLE_OB_MICRO_BLOCK_COMPRESS_PIPELINE_H_
+#define OCEANBASE_BLOCKSSTABLE_OB_MICRO_BLOCK_COMPRESS_PIPELINE_H_
+
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/lock/ob_thread_cond.h"
+#include "lib/thread/thread_mgr_interface.h"
+#include "storage/blocksstable/ob_macro_block_writer.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+class ObMicroBlockCompressPipeline;
+
+// An encoded micro block waiting for compression and encryption.
+// All memory referenced by desc_ is owned by the task, so that the macro block
+// writer can go on encoding the next micro block in its own buffer.
+class ObMicroBlockCompressTask
+{
+  friend class ObMicroBlockCompressPipeline;
+public:
+  enum Status
+  {
+    IDLE = 0,
+    COMPRESSING = 1,
+    DONE = 2,
+  };
+  ObMicroBlockCompressTask();
+  ~ObMicroBlockCompressTask();
+  int init(ObMicroBlockCompressPipeline &pipeline,
+           ObDataStoreDesc &data_store_desc,
+           ObTableReadInfo &read_info);
+  void reset();
+  // deep copy the encoded micro block
+  int fill(const ObMicroBlockDesc &micro_block_desc,
+           const common::ObIArray<uint32_t> &micro_rowkey_hashs);
+  // compress and encrypt the micro block, called in the thread of the compress pool
+  void process();
+  void reuse();
+
+  ObMicroBlockDesc &get_micro_block_desc() { return micro_block_desc_; }
+  common::ObArray<uint32_t> &get_micro_rowkey_hashs() { return micro_rowkey_hashs_; }
+  int64_t get_original_block_size() const { return original_block_size_; }
+  int get_ret() const { return ret_; }
+  TO_STRING_KV(K_(status), K_(ret), K_(original_block_size), K_(buf_capacity),
+               K_(compress_time), K_(micro_block_desc));
+private:
+  ObMicroBlockCompressPipeline *pipeline_;
+  ObMicroBlockBufferHelper helper_;
+  ObMicroBlockDesc micro_block_desc_;
+  ObMicroBlockHeader header_;
+  int64_t *column_checksums_;
+  int64_t column_checksum_cnt_;
+  char *buf_;
+  int64_t buf_capacity_;
+  int64_t original_block_size_;
+  common::ObArray<uint32_t> micro_rowkey_hashs_;
+  common::ObArenaAllocator allocator_;
+  common::ObArenaAllocator rowkey_allocator_;
+  int64_t status_;
+  int ret_;
+  int64_t compress_time_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockCompressTask);
+};
+
+// Tenant level thread pool compressing the micro blocks of compaction.
+//
+// The merge thread only encodes rows into micro blocks, the compression and
+// encryption of the encoded micro blocks run in this pool, and the compressed
+// micro blocks are appended to the macro block by the merge thread again in
+// the order they were built. Controlled by tenant config
+// _micro_block_compress_thread_count, 0 means compressing in the merge thread.
+class ObMicroBlockCompressPool : public lib::TGTaskHandler
+{
+public:
+  static const int64_t MAX_THREAD_CNT = 64;
+  static const int64_t REFRESH_CONFIG_INTERVAL = 5 * 1000 * 1000L; // 5s
+
+  ObMicroBlockCompressPool();
+  virtual ~ObMicroBlockCompressPool();
+  static int mtl_init(ObMicroBlockCompressPool *&compress_pool);
+  int init();
+  int start();
+  void stop();
+  void wait();
+  void destroy();
+
+  virtual void handle(void *task) override;
+  // return the thread count of the pool, 0 if disabled
+  int64_t get_thread_cnt();
+  int push_task(ObMicroBlockCompressTask &task);
+  // all threads of the pool have exited
+  bool has_stopped() const { return ATOMIC_LOAD(&has_stopped_); }
+  TO_STRING_KV(K_(is_inited), K_(has_stopped), K_(tg_id), K_(thread_cnt), K_(last_refresh_ts));
+private:
+  void refresh_config();
+private:
+  bool is_inited_;
+  bool has_stopped_;
+  int tg_id_;
+  int64_t thread_cnt_;
+  int64_t last_refresh_ts_;
+  common::ObSpinLock lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockCompressPool);
+};
+
+// Bounded in-order queue of the micro blocks of one macro block writer.
+//
+//   push(): copy an encoded micro block into the next free task and submit it to
+//           the compress pool, the caller must pop() first if the pipeline is full;
+//   wait_first(): wait for the oldest micro block to be compressed;
+//   pop(): release the oldest task after its micro block is written.
+//
+// Micro blocks are always written in the order they are pushed, and the macro block
+// writer drains the pipeline before any decision reading the compressed sizes, so
+// the layout of the macro blocks is the same as compressing inline, whatever the depth.
+class ObMicroBlockCompressPipeline
+{
+public:
+  static const int64_t MAX_TASK_CNT = 8;
+  static const int64_t WAIT_INTERVAL_US = 1000; // 1ms
+
+  ObMicroBlockCompressPipeline();
+  ~ObMicroBlockCompressPipeline();
+  int init(ObDataStoreDesc &data_store_desc,
+           ObTableReadInfo &read_info,
+           ObMicroBlockCompressPool &compress_pool,
+           const int64_t task_cnt);
+  // wait for all the submitted tasks, must be called before free
+  void reset();
+
+  int push(const ObMicroBlockDesc &micro_block_desc,
+           const common::ObIArray<uint32_t> &micro_rowkey_hashs);
+  int wait_first(ObMicroBlockCompressTask *&task);
+  int pop();
+  void on_task_done(ObMicroBlockCompressTask &task);
+
+  bool is_inited() const { return is_inited_; }
+  bool is_empty() const { return head_ == tail_; }
+  bool is_full() const { return tail_ - head_ >= task_cnt_; }
+  // total size of the pushed micro blocks before compression, not written yet
+  int64_t get_pending_size() const { return pending_size_; }
+  int64_t get_compress_time() const { return compress_time_; }
+  int64_t get_wait_time() const { return wait_time_; }
+  TO_STRING_KV(K_(is_inited), K_(task_cnt), K_(head), K_(tail), K_(pending_size), K_(compress_time), K_(wait_time));
+private:
+  void wait_task(ObMicroBlockCompressTask &task);
+private:
+  bool is_inited_;
+  ObMicroBlockCompressPool *compress_pool_;
+  ObMicroBlockCompressTask *tasks_[MAX_TASK_CNT];
+  int64_t task_cnt_;
+  int64_t head_;
+  int64_t tail_;
+  int64_t pending_size_;
+  int64_t compress_time_;
+  int64_t wait_time_;
+  common::ObThreadCond cond_;
+  DISALLOW_COPY_AND_ASSIGN(ObMicroBlockCompressPipeline);
+};
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_BLOCKSSTABLE_OB_MICRO_BLOCK_COMPRESS_PIPELINE_H_ */
@@ -391,6 +391,30 @@ int ObTmpFileExtent::read(const ObTmpFileIOInfo &io_info, const int64_t offset,
   return ret;
 }
 
+int ObTmpFileExtent::prefetch(const ObTmpFileIOInfo &io_info, const int64_t offset,
+    const int64_t size, ObMacroBlockHandle &mb_handle)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_alloced_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "ObTmpFileExtent has not been allocated", K(ret));
+  } else if (offset < 0 || offset >= offset_ || size <= 0 || offset + size > offset_) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), K(offset), K(offset_), K(size));
+  } else {
+    ObTmpBlockIOInfo info;
+    info.io_desc_ = io_info.io_desc_;
+    info.block_id_ = block_id_;
+    info.offset_ = start_page_id_ * ObTmpMacroBlock::get_default_page_size() + offset;
+    info.size_ = size;
+    info.tenant_id_ = io_info.tenant_id_;
+    if (OB_FAIL(OB_TMP_FILE_STORE.prefetch(owner_->get_tenant_id(), info, mb_handle))) {
+      STORAGE_LOG(WARN, "fail to prefetch the extent", K(ret), K(info), K(*this));
+    }
+  }
+  return ret;
+}
+
 int ObTmpFileExtent::write(const ObTmpFileIOInfo &io_info,int64_t &size, char *&buf)
 {
   int ret = OB_SUCCESS;
@@ -589,7 +613,12 @@ ObTmpFile::ObTmpFile()
     last_extent_min_offset_(0),
     last_extent_max_offset_(INT64_MAX),
     lock_(common::ObLatchIds::TMP_FILE_LOCK),
-    is_inited_(false)
+    is_inited_(false),
+    read_ahead_io_cnt_(0),
+    last_read_end_(0),
+    read_ahead_size_(0),
+    read_ahead_end_(0),
+    read_ahead_lock_(common::ObLatchIds::TMP_FILE_LOCK)
 {
 }
 
@@ -601,6 +630,16 @@ ObTmpFile::~ObTmpFile()
 int ObTmpFile::clear()
 {
   int ret = OB_SUCCESS;
+  {
+    ObSpinLockGuard guard(read_ahead_lock_);
+    for (int64_t i = 0; i < MAX_READ_AHEAD_IO_CNT; ++i) {
+      read_ahead_handles_[i].reset();
+    }
+    read_ahead_io_cnt_ = 0;
+    last_read_end_ = 0;
+    read_ahead_size_ = 0;
+    read_ahead_end_ = 0;
+  }
   if (OB_FAIL(file_meta_.clear())) {
     STORAGE_LOG(WARN, "fail to clear file meta", K(ret));
   } else {
@@ -771,21 +810,93 @@ int ObTmpFile::once_aio_read_batch_without_lock(
   return ret;
 }
 
+void ObTmpFile::release_finished_read_ahead()
+{
+  for (int64_t i = 0; i < MAX_READ_AHEAD_IO_CNT; ++i) {
+    if (read_ahead_handles_[i].get_io_handle().is_finished()) {
+      read_ahead_handles_[i].reset();
+    }
+  }
+}
+
+int ObTmpFile::read_ahead(const ObTmpFileIOInfo &io_info, const int64_t read_start,
+    const int64_t read_end)
+{
+  int ret = OB_SUCCESS;
+  ObTmpFileExtent *last_extent = file_meta_.get_last_extent();
+  common::ObIArray<ObTmpFileExtent *> &extents = file_meta_.get_extents();
+  if (OB_ISNULL(last_extent)) {
+    // empty file, nothing to read ahead
+  } else if (OB_SUCCESS != read_ahead_lock_.trylock()) {
+    // another reader of this file is reading ahead
+  } else {
+    release_finished_read_ahead();
+    if (read_start != last_read_end_) {
+      // not a sequential read, stop reading ahead until the next sequential one
+      read_ahead_size_ = 0;
+      read_ahead_end_ = 0;
+    } else if (0 == read_ahead_size_) {
+      read_ahead_size_ = MIN_READ_AHEAD_SIZE;
+    } else {
+      read_ahead_size_ = MIN(read_ahead_size_ * 2, MAX_READ_AHEAD_SIZE);
+    }
+    last_read_end_ = read_end;
+    const int64_t file_end = last_extent->get_global_end();
+    int64_t start = MAX(read_end, read_ahead_end_);
+    const int64_t end = MIN(read_end + read_ahead_size_, file_end);
+    // issue the read ahead once half of the window has been consumed, so that
+    // every io is large enough.
+    if (read_ahead_size_ > 0 && start < end && (end - start >= read_ahead_size_ / 2 || end == file_end)) {
+      int64_t ith_extent = start >= last_extent_min_offset_ ? last_extent_id_ : find_first_extent(start);
+      int64_t free_idx = 0;
+      while (OB_SUCC(ret) && ith_extent < extents.count() && start < end) {
+        ObTmpFileExtent *tmp = extents.at(ith_extent);
+        while (free_idx < MAX_READ_AHEAD_IO_CNT && !read_ahead_handles_[free_idx].get_io_handle().is_empty()) {
+          ++free_idx;
+        }
+        if (free_idx >= MAX_READ_AHEAD_IO_CNT) {
+          // too many read ahead io in flight, continue from here on the next read
+          break;
+        } else if (tmp->get_global_start() <= start && start < tmp->get_global_end()) {
+          const int64_t size = MIN(end, tmp->get_global_end()) - start;
+          ObMacroBlockHandle &mb_handle = read_ahead_handles_[free_idx];
+          if (OB_FAIL(tmp->prefetch(io_info, start - tmp->get_global_start(), size, mb_handle))) {
+            STORAGE_LOG(WARN, "fail to prefetch the extent", K(ret), K(start), K(size), KPC(tmp));
+            mb_handle.reset();
+          } else {
+            start += size;
+            ++read_ahead_io_cnt_;
+          }
+        }
+        ++ith_extent;
+      }
+      read_ahead_end_ = start;
+    }
+    read_ahead_lock_.unlock();
+  }
+  return ret;
+}
+
 int ObTmpFile::aio_read(const ObTmpFileIOInfo &io_info, ObTmpFileIOHandle &handle)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     STORAGE_LOG(WARN, "ObTmpFile has not been inited", K(ret));
   } else {
     tenant_id_ = io_info.tenant_id_;
     SpinWLockGuard guard(lock_);
+    const int64_t read_start = offset_;
     if (OB_FAIL(aio_read_without_lock(io_info, offset_, handle))) {
       if (OB_ITER_END != ret) {
         STORAGE_LOG(WARN, "fail to do aio read without lock", K(ret));
       }
     } else {
       handle.set_update_offset_in_file();
+      if (OB_SUCCESS != (tmp_ret = read_ahead(io_info, read_start, read_start + io_info.size_))) {
+        STORAGE_LOG(WARN, "fail to read ahead", K(tmp_ret), K(read_start), K(io_info));
+      }
     }
   }
   return ret;
@@ -794,6 +905,7 @@ int ObTmpFile::aio_pread(const ObTmpFileIOInfo &io_info, const int64_t offset,
     ObTmpFileIOHandle &handle)
 {
   int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
   if (OB_UNLIKELY(!is_inited_)) {
    ret = OB_NOT_INIT;
    STORAGE_LOG(WARN, "ObTmpFile has not been inited", K(ret));
@@ -804,6 +916,8 @@ int ObTmpFile::aio_pread(const ObTmpFileIOInfo &io_info, const int64_t offset,
       if (OB_ITER_END != ret) {
         STORAGE_LOG(WARN, "fail to do aio read without lock", K(ret));
       }
+    } else if (OB_SUCCESS != (tmp_ret = read_ahead(io_info, offset, offset + io_info.size_))) {
+      STORAGE_LOG(WARN, "fail to read ahead", K(tmp_ret), K(offset), K(io_info));
     }
   }
   return ret;
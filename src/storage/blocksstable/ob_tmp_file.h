@@ -14,6 +14,7 @@
 #define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_TMP_FILE_H_
 
 #include "lib/container/ob_se_array.h"
+#include "lib/lock/ob_spin_lock.h"
 #include "storage/blocksstable/ob_macro_block_handle.h"
 #include "storage/blocksstable/ob_block_manager.h"
 #include "storage/blocksstable/ob_tmp_file_store.h"
@@ -154,6 +155,9 @@ public:
   virtual ~ObTmpFileExtent();
   virtual int read(const ObTmpFileIOInfo &io_info, const int64_t offset, const int64_t size,
       char *buf, ObTmpFileIOHandle &handle);
+  // load the pages of [offset, offset + size) on disk into the tmp page cache asynchronously.
+  int prefetch(const ObTmpFileIOInfo &io_info, const int64_t offset, const int64_t size,
+      ObMacroBlockHandle &mb_handle);
   virtual int write(const ObTmpFileIOInfo &io_info, int64_t &size, char *&buf);
   void reset();
   OB_INLINE bool is_closed() const { return is_closed_; }
@@ -269,6 +273,8 @@ private:
   int64_t small_file_prealloc_size();
   int64_t big_file_prealloc_size();
   int64_t find_first_extent(const int64_t offset);
+  int read_ahead(const ObTmpFileIOInfo &io_info, const int64_t read_start, const int64_t read_end);
+  void release_finished_read_ahead();
 
 private:
   // NOTE:
@@ -277,6 +283,11 @@ private:
   static const int64_t SMALL_FILE_MAX_THRESHOLD = 4;
   static const int64_t BIG_FILE_PREALLOC_EXTENT_SIZE = 8;
   static const int64_t READ_SIZE_PER_BATCH = 8 * 1024 * 1024; // 8MB
+  // Sequential reads of spilled data are read ahead into the tmp page cache, the window
+  // starts from MIN_READ_AHEAD_SIZE and doubles on every sequential read.
+  static const int64_t MIN_READ_AHEAD_SIZE = 256 * 1024; // 256KB
+  static const int64_t MAX_READ_AHEAD_SIZE = 4 * 1024 * 1024; // 4MB
+  static const int64_t MAX_READ_AHEAD_IO_CNT = 8;
 
   ObTmpFileMeta file_meta_;
   bool is_big_;
@@ -288,6 +299,14 @@ private:
   int64_t last_extent_max_offset_;
   common::SpinRWLock lock_;
   bool is_inited_;
+  // the read ahead io is canceled once its handle is released, so keep the ones in flight,
+  // the io buffer is released with the handle once the pages are put into the page cache.
+  ObMacroBlockHandle read_ahead_handles_[MAX_READ_AHEAD_IO_CNT];
+  int64_t read_ahead_io_cnt_;
+  int64_t last_read_end_;
+  int64_t read_ahead_size_;
+  int64_t read_ahead_end_;
+  common::ObSpinLock read_ahead_lock_;
 
   DISALLOW_COPY_AND_ASSIGN(ObTmpFile);
 };
@@ -1297,6 +1297,71 @@ int ObTmpTenantFileStore::read_page(ObTmpMacroBlock *block, ObTmpBlockIOInfo &io
   return ret;
 }
 
+int ObTmpTenantFileStore::prefetch(const ObTmpBlockIOInfo &io_info, ObMacroBlockHandle &mb_handle)
+{
+  int ret = OB_SUCCESS;
+  ObTmpBlockValueHandle tb_handle;
+  ObTmpMacroBlock *block = NULL;
+  common::ObSEArray<ObTmpPageIOInfo, 16> page_io_infos;
+  const int64_t page_size = ObTmpMacroBlock::get_default_page_size();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObTmpTenantFileStore has not been inited", K(ret));
+  } else if (OB_UNLIKELY(io_info.offset_ < 0 || io_info.size_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), K(io_info));
+  } else if (OB_FAIL(tmp_block_manager_.get_macro_block(io_info.block_id_, block))) {
+    STORAGE_LOG(WARN, "fail to get block from tmp block manager", K(ret), K_(io_info.block_id));
+  } else if (OB_ISNULL(block)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "the block is NULL", K(ret), K_(io_info.block_id));
+  } else if (!block->is_disked() || OB_SUCCESS == block->get_block_cache_handle(tb_handle)) {
+    // the block is still in memory, nothing to prefetch.
+  } else {
+    const int64_t end_page_id = (io_info.offset_ + io_info.size_ - 1) / page_size;
+    for (int64_t page_id = io_info.offset_ / page_size; OB_SUCC(ret) && page_id <= end_page_id; ++page_id) {
+      ObTmpPageCacheKey key(io_info.block_id_, page_id, io_info.tenant_id_);
+      ObTmpPageValueHandle p_handle;
+      if (OB_SUCC(page_cache_->get_page(key, p_handle))) {
+        // already in page cache.
+      } else if (OB_ENTRY_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+        ObTmpPageIOInfo page_io_info;
+        page_io_info.key_ = key;
+        page_io_info.offset_ = 0;
+        page_io_info.size_ = page_size;
+        if (OB_FAIL(page_io_infos.push_back(page_io_info))) {
+          STORAGE_LOG(WARN, "Fail to push back into page_io_infos", K(ret), K(page_io_info));
+        }
+      } else {
+        STORAGE_LOG(WARN, "fail to get page from page cache", K(ret));
+      }
+    }
+
+    bool need_wait_write = false;
+    if (OB_SUCC(ret) && page_io_infos.count() > 0) {
+      SpinRLockGuard guard(lock_);
+      need_wait_write = tmp_mem_block_manager_.check_need_wait_write();
+    }
+    if (OB_FAIL(ret) || page_io_infos.count() <= 0 || need_wait_write) {
+      // don't block the reader for the prefetch, the pages will be read on demand.
+    } else {
+      // read the missing pages in one io, the cached pages in the middle are skipped by callback.
+      ObTmpBlockIOInfo info(io_info);
+      const int64_t start_page_id = page_io_infos.at(0).key_.get_page_id();
+      const int64_t page_nums = page_io_infos.at(page_io_infos.count() - 1).key_.get_page_id() - start_page_id + 1;
+      // just skip header and padding.
+      info.offset_ = start_page_id * page_size + ObTmpMacroBlock::get_header_padding();
+      info.size_ = page_nums * page_size;
+      info.macro_block_id_ = block->get_macro_block_id();
+      if (OB_FAIL(page_cache_->prefetch(info, page_io_infos, mb_handle, io_allocator_))) {
+        STORAGE_LOG(WARN, "fail to prefetch multi tmp page", K(ret), K(info));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTmpTenantFileStore::wait_write_io_finish_if_need()
 {
   // guarantee read io after the finished write.
@@ -1475,6 +1540,19 @@ int ObTmpFileStore::read(const uint64_t tenant_id, ObTmpBlockIOInfo &io_info,
   return ret;
 }
 
+int ObTmpFileStore::prefetch(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info,
+    ObMacroBlockHandle &mb_handle)
+{
+  int ret = OB_SUCCESS;
+  ObTmpTenantFileStoreHandle store_handle;
+  if (OB_FAIL(get_store(tenant_id, store_handle))) {
+    STORAGE_LOG(WARN, "fail to get tmp tenant file store", K(ret), K(tenant_id), K(io_info));
+  } else if (OB_FAIL(store_handle.get_tenant_store()->prefetch(io_info, mb_handle))) {
+    STORAGE_LOG(WARN, "fail to prefetch the extent", K(ret), K(tenant_id), K(io_info));
+  }
+  return ret;
+}
+
 int ObTmpFileStore::write(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info)
 {
   int ret = OB_SUCCESS;
@@ -234,6 +234,7 @@ public:
   int free(ObTmpFileExtent *extent);
   int free(const int64_t block_id, const int32_t start_page_id, const int32_t page_nums);
   int read(ObTmpBlockIOInfo &io_info, ObTmpFileIOHandle &handle);
+  int prefetch(const ObTmpBlockIOInfo &io_info, ObMacroBlockHandle &mb_handle);
   int write(const ObTmpBlockIOInfo &io_info);
   int get_disk_macro_block_list(common::ObIArray<MacroBlockId> &macro_id_list);
   void print_block_usage() { tmp_block_manager_.print_block_usage(); }
@@ -313,6 +314,7 @@ public:
   int alloc(const int64_t dir_id, const uint64_t tenant_id, const int64_t size,
       ObTmpFileExtent &extent);
   int read(const uint64_t tenant_id, ObTmpBlockIOInfo &io_info, ObTmpFileIOHandle &handle);
+  int prefetch(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info, ObMacroBlockHandle &mb_handle);
   int write(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info);
   int free(const uint64_t tenant_id, ObTmpFileExtent *extent);
   int free(const uint64_t tenant_id, const int64_t block_id, const int32_t start_page_id,
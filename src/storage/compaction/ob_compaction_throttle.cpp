@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE_COMPACTION
+
+#include "storage/compaction/ob_compaction_throttle.h"
+#include "share/io/ob_io_manager.h"
+#include "share/rc/ob_tenant_base.h"
+#include "share/scheduler/ob_dag_scheduler.h"
+#include "observer/ob_server_struct.h"
+#include "observer/omt/ob_multi_tenant.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "storage/compaction/ob_server_compaction_event_history.h"
+#include "storage/compaction/ob_tenant_tablet_scheduler.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace storage;
+namespace compaction
+{
+
+void ObCompactionThrottle::Decision::reset()
+{
+  concurrency_percent_ = 100;
+  io_limit_ = 0;
+  user_io_rt_ = 0;
+  cpu_usage_ = 0;
+  write_rate_ = 0;
+}
+
+ObCompactionThrottle::ObCompactionThrottle()
+  : decision_(),
+    available_bytes_(0),
+    written_bytes_(0),
+    last_written_bytes_(0),
+    last_refill_ts_(0),
+    last_adjust_ts_(0),
+    lock_()
+{
+}
+
+void ObCompactionThrottle::reset()
+{
+  ObSpinLockGuard guard(lock_);
+  decision_.reset();
+  available_bytes_ = 0;
+  written_bytes_ = 0;
+  last_written_bytes_ = 0;
+  last_refill_ts_ = 0;
+  last_adjust_ts_ = 0;
+}
+
+void ObCompactionThrottle::throttle_write(const ObMergeType merge_type, const int64_t size)
+{
+  int64_t wait_us = 0;
+  if (is_mini_merge(merge_type) || size <= 0) {
+    // not throttled
+  } else {
+    (void)ATOMIC_FAA(&written_bytes_, size);
+    const int64_t io_limit = get_io_limit();
+    if (io_limit > 0) {
+      ObSpinLockGuard guard(lock_);
+      const int64_t current_ts = ObTimeUtility::fast_current_time();
+      // at most one second of budget is accumulated
+      const int64_t elapsed_us = MIN(current_ts - last_refill_ts_, ADJUST_INTERVAL);
+      available_bytes_ = MIN(available_bytes_ + elapsed_us * io_limit / ADJUST_INTERVAL, io_limit);
+      available_bytes_ -= size;
+      last_refill_ts_ = current_ts;
+      if (available_bytes_ < 0) {
+        wait_us = MIN(-available_bytes_ * ADJUST_INTERVAL / io_limit, MAX_WAIT_US);
+      }
+    }
+  }
+  if (wait_us > 0) {
+    ob_usleep(wait_us);
+  }
+}
+
+int64_t ObCompactionThrottle::calc_cpu_usage_percent(const double cpu_usage, const double max_cpu)
+{
+  return max_cpu > 0 ? static_cast<int64_t>(cpu_usage * 100 / max_cpu) : 0;
+}
+
+void ObCompactionThrottle::sample(Decision &decision)
+{
+  int ret = OB_SUCCESS;
+  const int64_t current_ts = ObTimeUtility::fast_current_time();
+  const int64_t written_bytes = ATOMIC_LOAD(&written_bytes_);
+  ObTenantIOManager *io_manager = MTL(ObTenantIOManager *);
+  double cpu_usage = 0;
+  double min_cpu = 0;
+  double max_cpu = 0;
+
+  if (OB_NOT_NULL(io_manager)) {
+    // calculated by the io tuner every second
+    ObIOUsage::AvgItems avg_iops, avg_size, avg_rt;
+    io_manager->get_io_usage().get_io_usage(avg_iops, avg_size, avg_rt);
+    decision.user_io_rt_ = static_cast<int64_t>(
+        avg_rt[static_cast<int>(ObIOCategory::USER_IO)][static_cast<int>(ObIOMode::READ)]);
+  }
+  if (OB_ISNULL(GCTX.omt_)) {
+  } else if (OB_FAIL(GCTX.omt_->get_tenant_cpu_usage(MTL_ID(), cpu_usage))) {
+    LOG_WARN("failed to get tenant cpu usage", K(ret));
+  } else if (OB_FAIL(GCTX.omt_->get_tenant_cpu(MTL_ID(), min_cpu, max_cpu))) {
+    LOG_WARN("failed to get tenant cpu", K(ret));
+  } else {
+    // the usage is the count of busy cpus, scale it to the percent of the unit max cpu
+    decision.cpu_usage_ = calc_cpu_usage_percent(cpu_usage, max_cpu);
+  }
+  if (last_adjust_ts_ > 0 && current_ts > last_adjust_ts_) {
+    decision.write_rate_ = (written_bytes - last_written_bytes_) * ADJUST_INTERVAL / (current_ts - last_adjust_ts_);
+  }
+  last_written_bytes_ = written_bytes;
+  last_adjust_ts_ = current_ts;
+}
+
+void ObCompactionThrottle::decide(
+    const bool enable,
+    const int64_t rt_threshold,
+    const int64_t cpu_threshold,
+    Decision &decision)
+{
+  int64_t &percent = decision.concurrency_percent_;
+  int64_t &io_limit = decision.io_limit_;
+  if (!enable) {
+    percent = 100;
+    io_limit = 0;
+  } else if (decision.user_io_rt_ > rt_threshold || decision.cpu_usage_ > cpu_threshold) {
+    // busy, multiplicative decrease
+    percent = MAX(MIN_CONCURRENCY_PERCENT, MIN(percent, 100) / 2);
+    const int64_t base_limit = 0 == io_limit ? decision.write_rate_ : MIN(io_limit, MAX(decision.write_rate_, MIN_IO_LIMIT));
+    io_limit = MAX(MIN_IO_LIMIT, base_limit / 2);
+  } else if (decision.user_io_rt_ < rt_threshold / 2 && decision.cpu_usage_ < cpu_threshold / 2) {
+    // idle, additive increase
+    percent = MIN(MAX_CONCURRENCY_PERCENT, percent + CONCURRENCY_PERCENT_STEP);
+    if (0 == io_limit) {
+    } else if (percent >= 100 && io_limit > 2 * decision.write_rate_) {
+      // compaction no longer reaches the limit
+      io_limit = 0;
+    } else {
+      io_limit += IO_LIMIT_STEP;
+    }
+  } else if (percent > 100) {
+    // neither busy nor idle, give up the extra concurrency
+    percent = 100;
+  }
+}
+
+int ObCompactionThrottle::apply(const Decision &decision)
+{
+  int ret = OB_SUCCESS;
+  ObTenantDagScheduler *dag_scheduler = MTL(ObTenantDagScheduler *);
+  if (OB_ISNULL(dag_scheduler)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("dag scheduler is null", K(ret));
+  } else if (OB_FAIL(dag_scheduler->set_compaction_throttle(decision.concurrency_percent_))) {
+    LOG_WARN("failed to set compaction throttle", K(ret), K(decision));
+  } else {
+    ATOMIC_STORE(&decision_.concurrency_percent_, decision.concurrency_percent_);
+    ATOMIC_STORE(&decision_.io_limit_, decision.io_limit_);
+  }
+  return ret;
+}
+
+int ObCompactionThrottle::adjust()
+{
+  int ret = OB_SUCCESS;
+  bool enable = false;
+  int64_t rt_threshold = 0;
+  int64_t cpu_threshold = 0;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      enable = tenant_config->_enable_compaction_throttle;
+      rt_threshold = tenant_config->_compaction_throttle_io_rt_threshold;
+      cpu_threshold = tenant_config->_compaction_throttle_cpu_threshold;
+    }
+  } // end of ObTenantConfigGuard
+  Decision decision = decision_;
+  sample(decision);
+  decide(enable, rt_threshold, cpu_threshold, decision);
+  if (!decision.is_changed(decision_)) {
+  } else if (OB_FAIL(apply(decision))) {
+    LOG_WARN("failed to apply compaction throttle", K(ret), K(decision));
+  } else {
+    const int64_t frozen_version = MTL(ObTenantTabletScheduler *)->get_frozen_version();
+    FLOG_INFO("compaction throttle changed", K(decision), K(rt_threshold), K(cpu_threshold));
+    ADD_COMPACTION_EVENT(
+        MTL_ID(),
+        INVALID_MERGE_TYPE,
+        frozen_version,
+        ObServerCompactionEvent::COMPACTION_THROTTLE,
+        ObTimeUtility::fast_current_time(),
+        "decision", decision);
+  }
+  decision_.user_io_rt_ = decision.user_io_rt_;
+  decision_.cpu_usage_ = decision.cpu_usage_;
+  decision_.write_rate_ = decision.write_rate_;
+  return ret;
+}
+
+} // namespace compaction
+} // namespace oceanbase
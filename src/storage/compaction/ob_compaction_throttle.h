@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_STORAGE_COMPACTION_COMPACTION_THROTTLE_H_
+#define OB_STORAGE_COMPACTION_COMPACTION_THROTTLE_H_
+
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+#include "storage/ob_i_store.h"
+
+namespace oceanbase
+{
+namespace compaction
+{
+
+// Feedback controller of the resource used by the background compaction of a tenant.
+//
+// Every second the controller samples the average rt of the user read io of the tenant
+// and the cpu usage of the tenant, in percent of the max cpu of the tenant unit:
+//   busy: rt or cpu usage above the threshold, the compaction concurrency is halved and
+//         the write bandwidth of compaction is limited to half of the observed rate;
+//   idle: rt and cpu usage below half of the threshold, the limits are raised step by step,
+//         the concurrency may be raised above the thread score up to MAX_CONCURRENCY_PERCENT.
+// Mini merge is never throttled, or the memstore may be exhausted.
+//
+// The decisions are recorded in the server compaction event history.
+class ObCompactionThrottle
+{
+public:
+  static const int64_t ADJUST_INTERVAL = 1000L * 1000L; // 1s
+  static const int64_t MIN_CONCURRENCY_PERCENT = 10;
+  static const int64_t MAX_CONCURRENCY_PERCENT = 200;
+  static const int64_t CONCURRENCY_PERCENT_STEP = 10;
+  static const int64_t MIN_IO_LIMIT = 16L * 1024L * 1024L; // 16MB/s
+  static const int64_t IO_LIMIT_STEP = 16L * 1024L * 1024L; // 16MB/s
+  static const int64_t MAX_WAIT_US = 1000L * 1000L; // 1s
+
+  struct Decision
+  {
+    Decision() { reset(); }
+    void reset();
+    bool is_changed(const Decision &other) const
+    {
+      return concurrency_percent_ != other.concurrency_percent_ || io_limit_ != other.io_limit_;
+    }
+    TO_STRING_KV(K_(concurrency_percent), K_(io_limit), K_(user_io_rt), K_(cpu_usage), K_(write_rate));
+
+    int64_t concurrency_percent_;
+    int64_t io_limit_; // bytes per second of compaction write, 0 means unlimited
+    int64_t user_io_rt_; // us
+    int64_t cpu_usage_; // percent
+    int64_t write_rate_; // bytes per second of compaction write
+  };
+
+  ObCompactionThrottle();
+  ~ObCompactionThrottle() = default;
+  void reset();
+  // sample the load of the tenant and adjust the limits, called by timer
+  int adjust();
+  // account the write of a compaction, sleep if the write budget is exhausted
+  void throttle_write(const storage::ObMergeType merge_type, const int64_t size);
+  int64_t get_io_limit() const { return ATOMIC_LOAD(&decision_.io_limit_); }
+  int64_t get_concurrency_percent() const { return ATOMIC_LOAD(&decision_.concurrency_percent_); }
+  TO_STRING_KV(K_(decision), K_(available_bytes), K_(written_bytes), K_(last_refill_ts), K_(last_adjust_ts));
+private:
+  static int64_t calc_cpu_usage_percent(const double cpu_usage, const double max_cpu);
+  void sample(Decision &decision);
+  static void decide(const bool enable, const int64_t rt_threshold, const int64_t cpu_threshold, Decision &decision);
+  int apply(const Decision &decision);
+private:
+  Decision decision_;
+  int64_t available_bytes_;
+  int64_t written_bytes_;
+  int64_t last_written_bytes_;
+  int64_t last_refill_ts_;
+  int64_t last_adjust_ts_;
+  common::ObSpinLock lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObCompactionThrottle);
+};
+
+} // namespace compaction
+} // namespace oceanbase
+
+#endif // OB_STORAGE_COMPACTION_COMPACTION_THROTTLE_H_
@@ -807,7 +807,9 @@ bool ObPartitionMinorRowMergeIter::inner_check(const ObMergeParameter &merge_par
   if (!merge_param.is_multi_version_minor_merge() && !storage::is_backfill_tx_merge(merge_param.merge_type_)) {
     bret = false;
     LOG_WARN("Unexpected merge type for minor row merge iter", K(bret), K(merge_param));
-  } else if (merge_param.merge_level_ != MACRO_BLOCK_MERGE_LEVEL) {
+  } else if (merge_param.merge_level_ != MACRO_BLOCK_MERGE_LEVEL
+      && (merge_param.is_mini_merge() || !merge_param.is_multi_version_minor_merge())) {
+    // micro block level is only used by minor merge, where small sstables are still merged by rows
     bret = false;
     LOG_WARN("Unexpected merge level for minor row merge iter", K(bret), K(merge_param));
   } else if (!table_->is_multi_version_table()) {
@@ -1266,7 +1268,7 @@ int ObPartitionMinorMacroMergeIter::inner_init(const ObMergeParameter &merge_par
         stmt_allocator_,
         macro_block_iter_,
         false, /* reverse scan */
-        false, /* need micro info */
+        MICRO_BLOCK_MERGE_LEVEL == merge_param.merge_level_, /* need micro info */
         true /* need secondary meta */))) {
     LOG_WARN("Fail to scan macro block", K(ret), KPC(merge_param.full_read_info_));
     }
@@ -1490,12 +1492,24 @@ int ObPartitionMinorMacroMergeIter::next()
 int ObPartitionMinorMacroMergeIter::inner_next(const bool open_macro)
 {
   int ret = OB_SUCCESS;
-  bool need_check = false;
   if (macro_block_opened_ && OB_SUCC(row_iter_->get_next_row(curr_row_))) {
     iter_row_count_++;
   } else if (OB_UNLIKELY(OB_SUCCESS != ret && OB_ITER_END != ret)) {
     LOG_WARN("Failed to get next row", K(ret), K(*this));
-  } else if (OB_FAIL(next_range())) {
+  } else if (OB_FAIL(inner_next_range(open_macro))) {
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to inner next range", K(ret), K(*this));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMacroMergeIter::inner_next_range(const bool open_macro)
+{
+  int ret = OB_SUCCESS;
+  bool need_check = false;
+  if (OB_FAIL(next_range())) {
     if (OB_UNLIKELY(OB_ITER_END != ret)) {
       LOG_WARN("Failed to get next range", K(ret), K(*this));
     }
@@ -1559,5 +1573,319 @@ int ObPartitionMinorMacroMergeIter::get_curr_range(ObDatumRange &range) const
   return ret;
 }
 
+/*
+ *ObPartitionMinorMicroMergeIter
+ */
+ObPartitionMinorMicroMergeIter::ObPartitionMinorMicroMergeIter()
+  : micro_block_iter_(),
+    micro_row_scanner_(nullptr),
+    curr_micro_block_(nullptr),
+    macro_reader_(),
+    micro_level_opened_(false),
+    micro_block_opened_(false),
+    last_micro_block_reused_(false)
+{
+}
+
+ObPartitionMinorMicroMergeIter::~ObPartitionMinorMicroMergeIter()
+{
+  reset();
+}
+
+void ObPartitionMinorMicroMergeIter::reset()
+{
+  micro_block_iter_.reset();
+  if (OB_NOT_NULL(micro_row_scanner_)) {
+    micro_row_scanner_->~ObIMicroBlockRowScanner();
+    micro_row_scanner_ = nullptr;
+  }
+  curr_micro_block_ = nullptr;
+  micro_level_opened_ = false;
+  micro_block_opened_ = false;
+  last_micro_block_reused_ = false;
+  ObPartitionMinorMacroMergeIter::reset();
+}
+
+bool ObPartitionMinorMicroMergeIter::inner_check(const ObMergeParameter &merge_param)
+{
+  bool bret = true;
+
+  if (OB_UNLIKELY(merge_param.merge_level_ != MICRO_BLOCK_MERGE_LEVEL)) {
+    bret = false;
+    LOG_WARN("Unexpected merge level for minor micro merge iter", K(bret), K(merge_param));
+  } else if (OB_UNLIKELY(merge_param.is_mini_merge() || merge_param.is_full_merge_)) {
+    bret = false;
+    LOG_WARN("Unexpected merge type for minor micro merge iter", K(bret), K(merge_param));
+  } else {
+    bret = ObPartitionMinorMacroMergeIter::inner_check(merge_param);
+  }
+
+  return bret;
+}
+
+int ObPartitionMinorMicroMergeIter::inner_init(const ObMergeParameter &merge_param)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+
+  if (OB_FAIL(ObPartitionMinorMacroMergeIter::inner_init(merge_param))) {
+    LOG_WARN("Failed to do minor macro merge iter init", K(ret));
+  } else if (OB_ISNULL(buf = stmt_allocator_.alloc(sizeof(ObMultiVersionMicroBlockMinorMergeRowScanner)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc memory for minor merge micro block scanner", K(ret));
+  } else if (FALSE_IT(micro_row_scanner_ = new (buf) ObMultiVersionMicroBlockMinorMergeRowScanner(stmt_allocator_))) {
+  } else if (OB_FAIL(micro_row_scanner_->init(access_param_.iter_param_,
+                                              access_context_,
+                                              reinterpret_cast<ObSSTable *>(table_)))) {
+    LOG_WARN("Failed to init micro row scanner", K(ret), K(access_param_), K(access_context_));
+  } else {
+    curr_micro_block_ = nullptr;
+    micro_level_opened_ = false;
+    micro_block_opened_ = false;
+    last_micro_block_reused_ = false;
+  }
+
+  return ret;
+}
+
+// same as check_need_open_curr_macro_block, the range of the macro block has been checked
+bool ObPartitionMinorMicroMergeIter::check_need_open_curr_micro_block() const
+{
+  const ObMicroIndexInfo *micro_index_info = curr_micro_block_->micro_index_info_;
+  return micro_index_info->contain_uncommitted_row()
+      || micro_index_info->get_max_merged_trans_version() <= access_context_.trans_version_range_.base_version_;
+}
+
+int ObPartitionMinorMicroMergeIter::open_micro_level()
+{
+  int ret = OB_SUCCESS;
+
+  micro_block_iter_.reset();
+  if (OB_UNLIKELY(macro_block_opened_ || micro_level_opened_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected opened macro block to open by micro blocks", K(ret), K(*this));
+  } else if (OB_FAIL(micro_block_iter_.init(
+              curr_block_desc_.range_,
+              read_info_,
+              curr_block_desc_.macro_block_id_,
+              macro_block_iter_->get_micro_index_infos(),
+              macro_block_iter_->get_micro_endkeys(),
+              static_cast<ObRowStoreType>(curr_block_desc_.row_store_type_),
+              reinterpret_cast<ObSSTable *>(table_)))) {
+    LOG_WARN("Failed to init micro_block_iter", K(ret), K_(curr_block_desc));
+  } else {
+    micro_row_scanner_->reuse();
+    curr_micro_block_ = nullptr;
+    macro_block_opened_ = true;
+    micro_level_opened_ = true;
+    micro_block_opened_ = false;
+    last_micro_block_reused_ = last_macro_block_reused();
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_micro_block()
+{
+  int ret = OB_SUCCESS;
+  ObMicroBlockData decompressed_data;
+  ObMicroBlockDesMeta micro_des_meta;
+  bool is_compressed = false;
+  const ObMicroIndexInfo *micro_index_info = nullptr;
+
+  if (OB_UNLIKELY(!micro_level_opened_ || micro_block_opened_ || nullptr == curr_micro_block_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected status to open micro block", K(ret), K(*this));
+  } else if (OB_ISNULL(micro_index_info = curr_micro_block_->micro_index_info_)
+      || OB_UNLIKELY(!micro_index_info->is_valid())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block", K(ret), KPC(curr_micro_block_));
+  } else if (OB_FAIL(micro_index_info->row_header_->fill_micro_des_meta(false, micro_des_meta))) {
+    LOG_WARN("Fail to fill micro block deserialize meta", K(ret), KPC(micro_index_info));
+  } else if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(
+      micro_des_meta,
+      curr_micro_block_->data_.get_buf(),
+      curr_micro_block_->data_.get_buf_size(),
+      decompressed_data.get_buf(),
+      decompressed_data.get_buf_size(),
+      is_compressed))) {
+    LOG_WARN("Failed to decrypt and decompress data", K(ret), KPC_(curr_micro_block));
+  } else {
+    if (last_micro_block_reused_) {
+      // the scan status of the last opened micro block is useless after reusing
+      micro_row_scanner_->reuse();
+    }
+    if (OB_FAIL(micro_row_scanner_->set_range(curr_micro_block_->range_))) {
+      LOG_WARN("Failed to set range of micro scanner", K(ret), KPC_(curr_micro_block));
+    } else if (OB_FAIL(micro_row_scanner_->open(
+        curr_block_desc_.macro_block_id_,
+        decompressed_data,
+        micro_block_iter_.is_left_border(),
+        micro_block_iter_.is_right_border()))) {
+      LOG_WARN("Failed to open micro scanner", K(ret), KPC_(curr_micro_block));
+    } else if (last_micro_block_reused_) {
+      // the first rows may belong to the last rowkey of the reused micro block
+      bool is_first_row = false;
+      bool is_shadow_row = false;
+      if (OB_FAIL(static_cast<ObMultiVersionMicroBlockMinorMergeRowScanner *>(micro_row_scanner_)->
+                  get_first_row_mvcc_info(is_first_row, is_shadow_row))) {
+        LOG_WARN("Fail to check rowkey first row info", K(ret), KPC(micro_row_scanner_));
+      } else {
+        check_committing_trans_compacted_ = is_first_row;
+        is_rowkey_first_row_reused_ = !is_first_row;
+        is_rowkey_shadow_row_reused_ = !is_first_row && !is_shadow_row;
+        have_macro_output_row_ = false;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      micro_block_opened_ = true;
+      last_micro_block_reused_ = false;
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::next_micro_block(const bool open_micro, bool &opened)
+{
+  int ret = OB_SUCCESS;
+  opened = false;
+
+  if (nullptr != curr_micro_block_ && !micro_block_opened_) {
+    // the current micro block is skipped without opening, it has been reused
+    last_micro_block_reused_ = true;
+  }
+  micro_block_opened_ = false;
+  if (OB_FAIL(micro_block_iter_.next(curr_micro_block_))) {
+    curr_micro_block_ = nullptr;
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to get next micro block", K(ret));
+    }
+  } else if (OB_ISNULL(curr_micro_block_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null micro block", K(ret), K(*this));
+  } else if (open_micro || check_need_open_curr_micro_block()) {
+    if (OB_FAIL(open_curr_micro_block())) {
+      LOG_WARN("Failed to open curr micro block", K(ret), K(open_micro), K(*this));
+    } else {
+      opened = true;
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::inner_next(const bool open_macro)
+{
+  int ret = OB_SUCCESS;
+  bool finish = false;
+
+  while (OB_SUCC(ret) && !finish && micro_level_opened_) {
+    bool opened = false;
+    if (micro_block_opened_) {
+      if (OB_SUCC(micro_row_scanner_->get_next_row(curr_row_))) {
+        iter_row_count_++;
+        finish = true;
+      } else if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to get next row", K(ret), K(*this));
+      } else {
+        // the rows of current micro block are all output
+        ret = OB_SUCCESS;
+        curr_micro_block_ = nullptr;
+        micro_block_opened_ = false;
+        last_micro_block_reused_ = false;
+      }
+    } else if (OB_FAIL(next_micro_block(open_macro, opened))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to get next micro block", K(ret), K(*this));
+      } else {
+        // the micro blocks are all output, close the macro block
+        ret = OB_SUCCESS;
+        micro_level_opened_ = false;
+        // used to decide whether the last macro block is reused
+        macro_block_opened_ = !last_micro_block_reused_;
+        if (OB_FAIL(inner_next_range(open_macro))) {
+          if (OB_UNLIKELY(OB_ITER_END != ret)) {
+            LOG_WARN("Failed to inner next range", K(ret), K(*this));
+          }
+        } else {
+          finish = true;
+        }
+      }
+    } else if (!opened) {
+      // output current micro block as a range
+      finish = true;
+    }
+  }
+  if (OB_FAIL(ret) || finish) {
+  } else if (OB_FAIL(ObPartitionMinorMacroMergeIter::inner_next(open_macro))) {
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to inner next of minor macro merge iter", K(ret), K(*this));
+    }
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::open_curr_range(const bool for_rewrite, const bool for_compare)
+{
+  int ret = OB_SUCCESS;
+  const ObLogicMacroBlockId curr_macro_logic_id = curr_block_desc_.macro_meta_->get_logic_id();
+
+  if (OB_UNLIKELY(micro_block_opened_)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("Unexpected opened micro block to open", K(ret), K(*this));
+  } else if (micro_level_opened_) {
+    if (OB_FAIL(open_curr_micro_block())) {
+      LOG_WARN("Failed to open curr micro block", K(ret), K(*this));
+    } else if (OB_FAIL(next())) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("Failed to get next row of micro block", K(ret));
+      }
+    } else {
+      LOG_DEBUG("open curr range for micro block", K(*this));
+    }
+  } else if (for_rewrite) {
+    ret = ObPartitionMinorMacroMergeIter::open_curr_range(for_rewrite, for_compare);
+  } else if (OB_FAIL(open_micro_level())) {
+    LOG_WARN("Failed to open micro level of macro block", K(ret), K(*this));
+  } else if (OB_FAIL(next())) {
+    if (OB_UNLIKELY(OB_ITER_END != ret)) {
+      LOG_WARN("Failed to get next micro block", K(ret));
+    }
+  } else {
+    LOG_DEBUG("open curr range by micro blocks", K(*this));
+  }
+
+  if (!for_compare || micro_level_opened_ || for_rewrite) {
+  } else if (OB_ITER_END == ret) {
+    ret = OB_BLOCK_SWITCHED;
+    LOG_INFO("curr macro block changed", K(curr_block_desc_));
+  } else if (OB_SUCC(ret) && curr_macro_logic_id != curr_block_desc_.macro_meta_->get_logic_id()) {
+    ret = OB_BLOCK_SWITCHED;
+    LOG_INFO("curr macro block changed", K(curr_block_desc_));
+  }
+
+  return ret;
+}
+
+int ObPartitionMinorMicroMergeIter::get_curr_range(ObDatumRange &range) const
+{
+  int ret = OB_SUCCESS;
+
+  if (!micro_level_opened_) {
+    ret = ObPartitionMinorMacroMergeIter::get_curr_range(range);
+  } else if (OB_UNLIKELY(micro_block_opened_ || nullptr == curr_micro_block_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected micro block to get range", K(ret), K(*this));
+  } else {
+    range = curr_micro_block_->range_;
+    revise_macro_range(range);
+    range.set_left_closed();
+    range.set_right_closed();
+  }
+  return ret;
+}
+
 } //compaction
 } //oceanbase
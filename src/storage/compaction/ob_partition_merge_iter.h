@@ -39,6 +39,7 @@ struct ObMergeParameter;
 //     - major micro iter
 //  - minor row iter
 //    - minor macro iter
+//      - minor micro iter
 
 class ObPartitionMergeIter
 {
@@ -286,8 +287,10 @@ protected:
   int check_need_open_curr_macro_block(bool &need);
   int check_macro_block_recycle(const ObMacroBlockDesc &macro_desc, bool &can_recycle);
   int recycle_last_rowkey_in_macro_block(ObSSTableRowWholeScanner &iter);
-private:
+  // move to the next macro block, and open it if necessary
+  int inner_next_range(const bool open_macro);
   OB_INLINE bool last_macro_block_reused() const { return 1 == last_macro_block_reused_; }
+protected:
   blocksstable::ObIMacroBlockIterator *macro_block_iter_;
   blocksstable::ObMacroBlockDesc curr_block_desc_;
   blocksstable::ObDataMacroBlockMeta curr_block_meta_;
@@ -298,6 +301,49 @@ private:
   bool have_macro_output_row_;
 };
 
+// Minor merge iter reusing micro blocks.
+//
+// A macro block overlapping with other iters is not opened as a whole, it is iterated
+// by micro blocks instead, and only the micro blocks overlapping with other iters, or
+// containing uncommitted or recyclable rows, are opened and merged row by row. Other
+// micro blocks are output by ObPartitionMinorMerger as they are.
+class ObPartitionMinorMicroMergeIter : public ObPartitionMinorMacroMergeIter
+{
+public:
+  ObPartitionMinorMicroMergeIter();
+  virtual ~ObPartitionMinorMicroMergeIter();
+  virtual void reset() override;
+  virtual int open_curr_range(const bool for_rewrite, const bool for_compare = false) override;
+  virtual bool is_micro_block_opened() const override { return !micro_level_opened_ || micro_block_opened_; }
+  virtual int get_curr_range(blocksstable::ObDatumRange &range) const override;
+  virtual int get_curr_micro_block(const blocksstable::ObMicroBlock *&micro_block) override
+  {
+    micro_block = curr_micro_block_;
+    return OB_SUCCESS;
+  }
+  INHERIT_TO_STRING_KV("ObPartitionMinorMicroMergeIter", ObPartitionMinorMacroMergeIter,
+      K_(micro_level_opened), K_(micro_block_opened), K_(last_micro_block_reused),
+      KPC_(curr_micro_block), KP_(micro_row_scanner));
+protected:
+  virtual bool inner_check(const ObMergeParameter &merge_param) override;
+  virtual int inner_init(const ObMergeParameter &merge_param) override;
+  virtual int inner_next(const bool open_macro) override;
+private:
+  int open_micro_level();
+  int next_micro_block(const bool open_micro, bool &opened);
+  int open_curr_micro_block();
+  bool check_need_open_curr_micro_block() const;
+private:
+  ObIndexBlockMicroIterator micro_block_iter_;
+  blocksstable::ObIMicroBlockRowScanner *micro_row_scanner_;
+  const blocksstable::ObMicroBlock *curr_micro_block_;
+  blocksstable::ObMacroBlockReader macro_reader_;
+  // current macro block is iterated by micro blocks
+  bool micro_level_opened_;
+  bool micro_block_opened_;
+  bool last_micro_block_reused_;
+};
+
 static const int64_t DEFAULT_ITER_COUNT = 16;
 typedef common::ObSEArray<ObPartitionMergeIter*, DEFAULT_ITER_COUNT> MERGE_ITER_ARRAY;
 
@@ -404,9 +404,20 @@ int ObPartitionMergePolicy::find_mini_minor_merge_tables(
   }
 
   if (OB_SUCC(ret)) {
+    int64_t tier_width = 0;
+    int64_t max_read_amplification = DEFAULT_MAX_READ_AMPLIFICATION;
+    if (HISTORY_MINI_MINOR_MERGE != param.merge_type_) {
+      get_tiered_minor_merge_config(tier_width, max_read_amplification);
+    }
     result.suggest_merge_type_ = param.merge_type_;
-    if (OB_FAIL(refine_mini_minor_merge_result(result))) {
+    if (tier_width > 0) {
+      if (OB_FAIL(refine_tiered_minor_merge_result(tier_width, max_read_amplification, result))) {
+        LOG_WARN("failed to refine tiered minor merge result", K(ret), K(tier_width), K(max_read_amplification));
+      }
+    } else if (OB_FAIL(refine_mini_minor_merge_result(result))) {
       LOG_WARN("failed to refine_minor_merge_result", K(ret));
+    }
+    if (OB_FAIL(ret)) {
     } else {
       result.version_range_.multi_version_start_ = tablet.get_multi_version_start();
       result.version_range_.snapshot_version_ = tablet.get_snapshot_version();
@@ -658,6 +669,8 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
   const ObTabletTableStore &table_store = tablet.get_table_store();
   const ObTabletID &tablet_id = tablet.get_tablet_meta().tablet_id_;
   int64_t delay_merge_schedule_interval = 0;
+  int64_t tier_width = 0;
+  int64_t max_read_amplification = DEFAULT_MAX_READ_AMPLIFICATION;
   ObTablesHandleArray minor_tables;
   {
     omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
@@ -666,6 +679,11 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
       delay_merge_schedule_interval = tenant_config->_minor_compaction_interval;
     }
   } // end of ObTenantConfigGuard
+  get_tiered_minor_merge_config(tier_width, max_read_amplification);
+  if (tier_width > 0) {
+    // size tiered, at least tier_width sstables are merged together
+    mini_minor_threshold = MIN(tier_width, max_read_amplification) - 1;
+  }
   if (table_store.get_minor_sstables().count_ <= mini_minor_threshold) {
     // total number of mini sstable is less than threshold + 1
   } else if (tablet.is_ls_tx_data_tablet()) {
@@ -678,6 +696,33 @@ int ObPartitionMergePolicy::check_need_mini_minor_merge(
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(table_store.get_mini_minor_sstables(minor_tables))) {
     LOG_WARN("failed to get mini minor sstables", K(ret), K(table_store));
+  } else if (tier_width > 0) {
+    ObSEArray<int64_t, MAX_SSTABLE_CNT_IN_STORAGE> table_sizes;
+    bool found_greater = false;
+    for (int64_t i = 0; OB_SUCC(ret) && i < minor_tables.get_count(); ++i) {
+      ObSSTable *table = static_cast<ObSSTable *>(minor_tables.get_table(i));
+      if (!found_greater && table->get_upper_trans_version() <= min_snapshot_version) {
+        continue;
+      } else if (table->get_max_merged_trans_version() > max_snapshot_version) {
+        break;
+      } else if (FALSE_IT(found_greater = true)) {
+      } else if (OB_FAIL(table_sizes.push_back(table->get_meta().get_basic_meta().row_count_))) {
+        LOG_WARN("failed to push back table size", K(ret));
+      }
+    }
+    int64_t start_idx = 0;
+    int64_t end_idx = 0;
+    minor_sstable_count = table_sizes.count();
+    if (OB_FAIL(ret) || minor_sstable_count <= 1) {
+    } else if (table_store.get_table_count() >= MAX_SSTABLE_CNT_IN_STORAGE - RESERVED_STORE_CNT_IN_STORAGE) {
+      need_merge = true;
+      LOG_INFO("table store has too many sstables, need to compaction", K(table_store));
+    } else if (OB_FAIL(find_tiered_merge_range(table_sizes, tier_width, max_read_amplification, start_idx, end_idx))) {
+      LOG_WARN("failed to find tiered merge range", K(ret), K(table_sizes), K(tier_width));
+    } else {
+      need_merge = end_idx - start_idx > 1;
+      need_merge_mini_count = end_idx - start_idx;
+    }
   } else {
     int64_t minor_check_snapshot_version = 0;
     bool found_greater = false;
@@ -1144,6 +1189,154 @@ int ObPartitionMergePolicy::refine_mini_minor_merge_result(ObGetMergeTablesResul
   return ret;
 }
 
+void ObPartitionMergePolicy::get_tiered_minor_merge_config(
+    int64_t &tier_width,
+    int64_t &max_read_amplification)
+{
+  tier_width = 0;
+  max_read_amplification = DEFAULT_MAX_READ_AMPLIFICATION;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    tier_width = tenant_config->_minor_compaction_tier_width;
+    max_read_amplification = tenant_config->_minor_compaction_max_read_amplification;
+  }
+  if (tier_width > 0) {
+    // merging one sstable makes no sense
+    tier_width = MAX(tier_width, 2);
+    max_read_amplification = MAX(max_read_amplification, 2);
+  }
+}
+
+/*
+ * Size tiered minor compaction for write heavy tables, a hybrid of tiered L0 and leveled L1:
+ *   the continuous sstables with similar row count make up a tier, the newest tier with at
+ *   least tier_width sstables is merged, so that each row is rewritten about
+ *   log(total_rows / mini_rows) / log(tier_width) times instead of once per minor merge;
+ *   the minor sstables are all merged together when a point get needs to read more than
+ *   max_read_amplification of them, into a new mini sstable if they are all mini sstables.
+ */
+int ObPartitionMergePolicy::find_tiered_merge_range(
+    const ObIArray<int64_t> &table_sizes,
+    const int64_t tier_width,
+    const int64_t max_read_amplification,
+    int64_t &start_idx,
+    int64_t &end_idx)
+{
+  int ret = OB_SUCCESS;
+  const int64_t table_cnt = table_sizes.count();
+  start_idx = 0;
+  end_idx = 0;
+  if (OB_UNLIKELY(tier_width < 2 || max_read_amplification < 2)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(tier_width), K(max_read_amplification));
+  } else if (table_cnt > max_read_amplification) {
+    end_idx = table_cnt;
+  } else {
+    int64_t tier_end = table_cnt;
+    int64_t tier_size = 0;
+    for (int64_t i = table_cnt - 1; i >= 0 && 0 == end_idx; --i) {
+      const int64_t size = MAX(table_sizes.at(i), 1);
+      const int64_t tier_cnt = tier_end - i - 1;
+      if (tier_cnt > 0) {
+        const int64_t avg_size = tier_size / tier_cnt;
+        if (size > avg_size * TIER_SIZE_RATIO || size * TIER_SIZE_RATIO < avg_size) {
+          if (tier_cnt >= tier_width) {
+            start_idx = i + 1;
+            end_idx = tier_end;
+          } else {
+            // start a new tier
+            tier_end = i + 1;
+            tier_size = 0;
+          }
+        }
+      }
+      tier_size += size;
+    }
+    if (0 == end_idx && tier_end >= tier_width) {
+      end_idx = tier_end;
+    }
+  }
+  return ret;
+}
+
+int ObPartitionMergePolicy::refine_tiered_minor_merge_result(
+    const int64_t tier_width,
+    const int64_t max_read_amplification,
+    ObGetMergeTablesResult &result)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObITable *, MAX_SSTABLE_CNT_IN_STORAGE> tables;
+  ObSEArray<int64_t, MAX_SSTABLE_CNT_IN_STORAGE> table_sizes;
+  ObITable *table = nullptr;
+  int64_t start_idx = 0;
+  int64_t end_idx = 0;
+  int64_t mini_sstable_count = 0;
+  int64_t minor_sstable_count = 0;
+  bool is_chaos_order = false;
+  int64_t minor_compact_trigger = DEFAULT_MINOR_COMPACT_TRIGGER;
+  {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      minor_compact_trigger = tenant_config->minor_compact_trigger;
+    }
+  } // end of ObTenantConfigGuard
+
+  for (int64_t i = 0; OB_SUCC(ret) && i < result.handle_.get_count(); ++i) {
+    if (OB_ISNULL(table = result.handle_.get_table(i)) || !table->is_minor_sstable()) {
+      ret = OB_ERR_SYS;
+      LOG_ERROR("get unexpected table", KP(table), K(ret));
+    } else if (OB_FAIL(tables.push_back(table))) {
+      LOG_WARN("failed to push back table", K(ret));
+    } else if (OB_FAIL(table_sizes.push_back(
+        static_cast<ObSSTable *>(table)->get_meta().get_basic_meta().row_count_))) {
+      LOG_WARN("failed to push back table size", K(ret));
+    } else if (table->is_mini_sstable()) {
+      ++mini_sstable_count;
+    } else if (table->is_multi_version_minor_sstable()) {
+      // minor sstable after mini sstable OR more than one minor sstable
+      is_chaos_order = is_chaos_order || mini_sstable_count > 0 || minor_sstable_count > 0;
+      ++minor_sstable_count;
+    }
+  }
+
+  if (OB_FAIL(ret) || tables.count() <= 1) {
+    result.handle_.reset();
+  } else if (0 == minor_compact_trigger || is_chaos_order) {
+    // same as the leveled policy, all the minor sstables are merged into L1
+    result.suggest_merge_type_ = MINOR_MERGE;
+    LOG_INFO("tiered minor refine, merge all minor sstables", K(minor_compact_trigger), K(is_chaos_order),
+             K(table_sizes), K(result));
+  } else if (OB_FAIL(find_tiered_merge_range(table_sizes, tier_width, max_read_amplification, start_idx, end_idx))) {
+    LOG_WARN("failed to find tiered merge range", K(ret), K(table_sizes));
+  } else if (end_idx - start_idx <= 1) {
+    LOG_INFO("tiered minor refine, no tier to merge", K(table_sizes), K(tier_width), K(max_read_amplification));
+    result.handle_.reset();
+  } else {
+    // L1 sstable is always the oldest, the tables without it are merged into a new L0 sstable
+    result.suggest_merge_type_ = MINI_MINOR_MERGE;
+    result.reset_handle_and_range();
+    for (int64_t i = start_idx; OB_SUCC(ret) && i < end_idx; ++i) {
+      table = tables.at(i);
+      if (!table->is_mini_sstable()) {
+        result.suggest_merge_type_ = MINOR_MERGE;
+      }
+      if (OB_FAIL(result.handle_.add_table(table))) {
+        LOG_WARN("Failed to add table to minor merge result", KPC(table), K(ret));
+      } else {
+        if (1 == result.handle_.get_count()) {
+          result.scn_range_.start_scn_ = table->get_start_scn();
+        }
+        result.scn_range_.end_scn_ = table->get_end_scn();
+      }
+    }
+    if (OB_SUCC(ret)) {
+      LOG_INFO("tiered minor refine", K(start_idx), K(end_idx), K(table_sizes), K(tier_width),
+               K(max_read_amplification), K(result));
+    }
+  }
+  return ret;
+}
+
 ObITable *ObPartitionMergePolicy::get_latest_sstable(const ObTabletTableStore &table_store)
 {
   ObITable *major_table = table_store.get_major_sstables().get_boundary_table(true/*last*/);
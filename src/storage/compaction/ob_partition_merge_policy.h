@@ -93,6 +93,15 @@ public:
   static int diagnose_table_count_unsafe(
       const storage::ObMergeType &merge_type,
       const storage::ObTablet &tablet);
+
+  // size tiered minor compaction, find the tables to merge in [start_idx, end_idx),
+  // %table_sizes are the row counts of the continuous minor sstables from old to new
+  static int find_tiered_merge_range(
+      const common::ObIArray<int64_t> &table_sizes,
+      const int64_t tier_width,
+      const int64_t max_read_amplification,
+      int64_t &start_idx,
+      int64_t &end_idx);
 private:
   static int find_mini_merge_tables(
       const storage::ObGetMergeTablesParam &param,
@@ -122,6 +131,11 @@ private:
       const storage::ObTablet &tablet,
       storage::ObGetMergeTablesResult &result);
   static int refine_mini_minor_merge_result(storage::ObGetMergeTablesResult &result);
+  static int refine_tiered_minor_merge_result(
+      const int64_t tier_width,
+      const int64_t max_read_amplification,
+      storage::ObGetMergeTablesResult &result);
+  static void get_tiered_minor_merge_config(int64_t &tier_width, int64_t &max_read_amplification);
 
   static int deal_with_minor_result(
       const storage::ObMergeType &merge_type,
@@ -160,6 +174,9 @@ public:
   static const int64_t OB_UNSAFE_TABLE_CNT = 32;
   static const int64_t OB_EMERGENCY_TABLE_CNT = 56;
   static const int64_t DEFAULT_MINOR_COMPACT_TRIGGER = 2;
+  static const int64_t DEFAULT_MAX_READ_AMPLIFICATION = 16;
+  // sstables in a tier differ from the average size of the tier by less than this ratio
+  static const int64_t TIER_SIZE_RATIO = 2;
 
   typedef int (*GetMergeTables)(const storage::ObGetMergeTablesParam&,
                                 const int64_t,
@@ -977,6 +977,52 @@ int ObPartitionMinorMerger::append_bloom_filter(const ObDatumRow &row)
   return ret;
 }
 
+// The rows of a reused micro block are not read, so their rowkey hashes are not collected:
+// the macro block writer builds no bloom filter for the macro block holding the micro block
+// (see ObMacroBlockWriter::write_micro_block), and the sstable bloom filter is given up.
+int ObPartitionMinorMerger::merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ObMicroBlock *micro_block = nullptr;
+  bool need_merge = false;
+  if (OB_FAIL(iter.get_curr_micro_block(micro_block))) {
+    STORAGE_LOG(WARN, "Failed to get current micro block", K(ret), K(iter));
+  } else if (OB_ISNULL(micro_block)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "Unexpected null micro block", K(ret), K(iter));
+  } else if (OB_FAIL(macro_writer_->check_micro_block_need_merge(*micro_block, need_merge))) {
+    STORAGE_LOG(WARN, "Failed to check micro block need merge", K(ret), KPC(micro_block));
+  } else if (need_merge) {
+    // macro block writer forbids merging micro blocks of minor sstable, rewrite the rows
+    if (OB_FAIL(iter.open_curr_range(false /* rewrite */))) {
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+      } else {
+        STORAGE_LOG(WARN, "Failed to open the curr micro block", K(ret), K(iter));
+      }
+    }
+  } else if (OB_FAIL(process(*micro_block))) {
+    STORAGE_LOG(WARN, "Failed to append micro block", K(ret), KPC(micro_block));
+  } else if (FALSE_IT(reuse_row_cnt += micro_block->header_.row_count_)) {
+  } else if (FALSE_IT(give_up_bloom_filter())) {
+  } else if (OB_FAIL(iter.next())) {
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    } else {
+      STORAGE_LOG(WARN, "Failed to get next row", K(ret));
+    }
+  }
+  return ret;
+}
+
+void ObPartitionMinorMerger::give_up_bloom_filter()
+{
+  if (need_build_bloom_filter_) {
+    need_build_bloom_filter_ = false;
+    bf_macro_writer_.reset();
+  }
+}
+
 int ObPartitionMinorMerger::rewrite_macro_block(MERGE_ITER_ARRAY &minimum_iters)
 {
   int ret = OB_SUCCESS;
@@ -1055,9 +1101,20 @@ int ObPartitionMinorMerger::merge_partition(ObTabletMergeCtx &ctx, const int64_t
       } else if (FALSE_IT(set_base_iter(rowkey_minimum_iters))) {
       } else if (1 == rowkey_minimum_iters.count()
           && nullptr == rowkey_minimum_iters.at(0)->get_curr_row()) {
-        // only one iter, output its' macro block
-        if (OB_FAIL(merge_macro_block_iter(rowkey_minimum_iters, reuse_row_cnt))) {
-          STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(rowkey_minimum_iters));
+        // only one iter, output its' macro block or micro block
+        ObPartitionMergeIter *iter = rowkey_minimum_iters.at(0);
+        if (!iter->is_macro_block_opened()) {
+          if (OB_FAIL(merge_macro_block_iter(rowkey_minimum_iters, reuse_row_cnt))) {
+            STORAGE_LOG(WARN, "Failed to merge_macro_block_iter", K(ret), K(rowkey_minimum_iters));
+          }
+        } else if (!iter->is_micro_block_opened()) {
+          // only minor micro merge iter will set the micro_block_opened flag
+          if (OB_FAIL(merge_micro_block_iter(*iter, reuse_row_cnt))) {
+            STORAGE_LOG(WARN, "Failed to merge_micro_block_iter", K(ret), K(rowkey_minimum_iters));
+          }
+        } else {
+          ret = OB_ERR_UNEXPECTED;
+          STORAGE_LOG(WARN, "cur row is null, but block opened", K(ret), KPC(iter));
         }
       } else if (OB_FAIL(merge_same_rowkey_iters(rowkey_minimum_iters))) {
         STORAGE_LOG(WARN, "Failed to merge iters with same rowkey", K(ret), K(rowkey_minimum_iters));
@@ -101,6 +101,7 @@ protected:
   virtual int merge_same_rowkey_iters(MERGE_ITER_ARRAY &merge_iters) override;
 private:
   int merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt);
+  void give_up_bloom_filter();
   int reuse_base_sstable(ObPartitionMajorMergeHelper &merge_helper);
   int get_macro_block_count_to_rewrite(const blocksstable::ObDatumRange &merge_range,
                                        int64_t &need_rewrite_block_cnt);
@@ -142,6 +143,8 @@ protected:
 private:
   int check_add_shadow_row(MERGE_ITER_ARRAY &merge_iters, const bool contain_multi_trans, bool &add_shadow_row);
   int merge_single_iter(ObPartitionMergeIter &merge_ite);
+  int merge_micro_block_iter(ObPartitionMergeIter &iter, int64_t &reuse_row_cnt);
+  void give_up_bloom_filter();
   int check_first_committed_row(const MERGE_ITER_ARRAY &merge_iters);
   int set_result_flag(MERGE_ITER_ARRAY &fuse_iters,
                       const bool rowkey_first_row,
@@ -961,7 +961,11 @@ ObPartitionMergeIter *ObPartitionMinorMergeHelper::alloc_merge_iter(const ObMerg
   if (storage::is_backfill_tx_merge(merge_param.merge_type_)) {
     merge_iter = alloc_helper<ObPartitionMinorRowMergeIter> (allocator_);
   } else if (!is_small_sstable && !merge_param.is_mini_merge() && !merge_param.is_full_merge_ && merge_param.sstable_logic_seq_ < ObMacroDataSeq::MAX_SSTABLE_SEQ) {
-    merge_iter = alloc_helper<ObPartitionMinorMacroMergeIter>(allocator_);
+    if (MICRO_BLOCK_MERGE_LEVEL == merge_param.merge_level_) {
+      merge_iter = alloc_helper<ObPartitionMinorMicroMergeIter>(allocator_);
+    } else {
+      merge_iter = alloc_helper<ObPartitionMinorMacroMergeIter>(allocator_);
+    }
   } else {
     merge_iter = alloc_helper<ObPartitionMinorRowMergeIter>(allocator_);
   }
@@ -28,6 +28,7 @@ const char *ObServerCompactionEvent::ObCompactionEventStr[] = {
     "SCHEDULER_LOOP",
     "TABLET_COMPACTION_FINISHED",
     "COMPACTION_REPORT",
+    "COMPACTION_THROTTLE",
 };
 
 const char *ObServerCompactionEvent::get_comp_event_str(enum ObCompactionEvent event)
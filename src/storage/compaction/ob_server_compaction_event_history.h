@@ -31,6 +31,7 @@ public:
     SCHEDULER_LOOP,
     TABLET_COMPACTION_FINISHED,
     COMPACTION_REPORT,
+    COMPACTION_THROTTLE,
     COMPACTION_EVENT_MAX,
   };
 
@@ -23,6 +23,7 @@
 #include "storage/compaction/ob_sstable_merge_info_mgr.h"
 #include "storage/compaction/ob_tenant_tablet_scheduler.h"
 #include "observer/omt/ob_multi_tenant.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/scheduler/ob_dag_warning_history_mgr.h"
 
 namespace oceanbase
@@ -896,6 +897,13 @@ int ObTabletMergeCtx::cal_minor_merge_param()
     is_full_merge_ = false;
     merge_level_ = MACRO_BLOCK_MERGE_LEVEL;
     read_base_version_ = 0;
+    if (param_.is_minor_merge()) {
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+      if (tenant_config.is_valid() && tenant_config->_enable_minor_micro_block_reuse) {
+        // reuse the micro blocks of the macro blocks that can not be reused as a whole
+        merge_level_ = MICRO_BLOCK_MERGE_LEVEL;
+      }
+    }
   }
   return ret;
 }
@@ -1220,6 +1228,11 @@ void ObTabletMergeCtx::collect_running_info()
 
   ADD_COMPACTION_INFO_PARAM(sstable_merge_info.comment_, sizeof(sstable_merge_info.comment_),
       "time_guard", time_guard_);
+  if (sstable_merge_info.compress_time_ > 0) {
+    ADD_COMPACTION_INFO_PARAM(sstable_merge_info.comment_, sizeof(sstable_merge_info.comment_),
+        "compress_time", sstable_merge_info.compress_time_,
+        "compress_wait_time", sstable_merge_info.compress_wait_time_);
+  }
 
   const int64_t dag_key = merge_dag_->hash();
   // calc flush macro speed
@@ -132,6 +132,14 @@ void ObTenantTabletScheduler::SSTableGCTask::runTimerTask()
   LOG_INFO("SSTableGCTask", K(cost_ts));
 }
 
+void ObTenantTabletScheduler::CompactionThrottleTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(MTL(ObTenantTabletScheduler *)->get_compaction_throttle().adjust())) {
+    LOG_WARN("Fail to adjust compaction throttle", K(ret));
+  }
+}
+
 constexpr ObMergeType ObTenantTabletScheduler::MERGE_TYPES[];
 
 ObTenantTabletScheduler::ObTenantTabletScheduler()
@@ -148,6 +156,8 @@ ObTenantTabletScheduler::ObTenantTabletScheduler()
    schedule_stats_(),
    merge_loop_task_(),
    sstable_gc_task_(),
+   compaction_throttle_task_(),
+   compaction_throttle_(),
    fast_freeze_checker_()
 {
   STATIC_ASSERT(static_cast<int64_t>(NO_MAJOR_MERGE_TYPE_CNT) == ARRAYSIZEOF(MERGE_TYPES), "merge type array len is mismatch");
@@ -170,6 +180,7 @@ void ObTenantTabletScheduler::destroy()
   schedule_stats_.reset();
   merge_loop_tg_id_ = 0;
   sstable_gc_tg_id_ = 0;
+  compaction_throttle_.reset();
   schedule_interval_ = 0;
   is_inited_ = false;
   LOG_INFO("The ObTenantTabletScheduler destroy");
@@ -227,6 +238,9 @@ int ObTenantTabletScheduler::start()
     LOG_WARN("failed to start sstable gc thread", K(ret));
   } else if (OB_FAIL(TG_SCHEDULE(sstable_gc_tg_id_, sstable_gc_task_, SSTABLE_GC_INTERVAL, repeat))) {
     LOG_WARN("Fail to schedule sstable gc task", K(ret));
+  } else if (OB_FAIL(TG_SCHEDULE(sstable_gc_tg_id_, compaction_throttle_task_, // light task, shares the timer of sstable gc
+      compaction::ObCompactionThrottle::ADJUST_INTERVAL, repeat))) {
+    LOG_WARN("Fail to schedule compaction throttle task", K(ret));
   }
   return ret;
 }
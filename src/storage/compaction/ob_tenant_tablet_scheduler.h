@@ -17,6 +17,7 @@
 #include "lib/queue/ob_dedup_queue.h"
 #include "share/ob_ls_id.h"
 #include "storage/ob_i_store.h"
+#include "storage/compaction/ob_compaction_throttle.h"
 
 namespace oceanbase
 {
@@ -107,6 +108,7 @@ public:
   OB_INLINE bool could_major_merge_start() const { return major_merge_status_; }
 
   int64_t get_frozen_version() const;
+  compaction::ObCompactionThrottle &get_compaction_throttle() { return compaction_throttle_; }
   int64_t get_merged_version() const { return merged_version_; }
   int64_t get_bf_queue_size() const { return bf_queue_.task_count(); }
   int merge_all();
@@ -174,6 +176,13 @@ private:
     virtual ~SSTableGCTask() = default;
     virtual void runTimerTask() override;
   };
+  class CompactionThrottleTask : public common::ObTimerTask
+  {
+  public:
+    CompactionThrottleTask() = default;
+    virtual ~CompactionThrottleTask() = default;
+    virtual void runTimerTask() override;
+  };
 public:
   static const int64_t INIT_COMPACTION_SCN = 1;
 
@@ -208,6 +217,8 @@ private:
   ObScheduleStatistics schedule_stats_;
   MergeLoopTask merge_loop_task_;
   SSTableGCTask sstable_gc_task_;
+  CompactionThrottleTask compaction_throttle_task_;
+  compaction::ObCompactionThrottle compaction_throttle_;
   ObFastFreezeChecker fast_freeze_checker_;
 };
 
@@ -38,6 +38,7 @@
 #include "storage/ob_row_reshape.h"
 #include "storage/ob_storage_struct.h"
 #include "storage/ob_storage_table_guard.h"
+#include "storage/ob_store_row_comparer.h"
 #include "storage/ob_value_row_iterator.h"
 #include "storage/access/ob_table_scan_iterator.h"
 #include "storage/access/ob_table_scan_range.h"
@@ -3431,8 +3432,16 @@ int ObLSTabletService::insert_tablet_rows(
     LOG_WARN("rowkeys already exist", K(ret), K(table), K(rows_info));
   }
 
+  // rows of a non-unique index never conflict with each other, they are inserted
+  // in rowkey order so that the adjacent keys share the path of the memtable btree.
+  ObStoreRow **sorted_rows = nullptr;
+  if (OB_FAIL(ret) || check_exists || row_count <= 1) {
+  } else if (OB_FAIL(sort_rows_by_rowkey(run_ctx, rows, row_count, sorted_rows))) {
+    LOG_WARN("failed to sort rows by rowkey", K(ret), K(row_count));
+  }
+
   for (int64_t k = 0; OB_SUCC(ret) && k < row_count; k++) {
-    ObStoreRow &tbl_row = rows[k];
+    ObStoreRow &tbl_row = nullptr == sorted_rows ? rows[k] : *sorted_rows[k];
     if (GCONF.enable_defensive_check()
           && OB_FAIL(check_new_row_legitimacy(run_ctx, tbl_row.row_val_))) {
         LOG_WARN("check new row legitimacy failed", K(ret), K(tbl_row.row_val_));
@@ -3463,6 +3472,45 @@ int ObLSTabletService::insert_tablet_rows(
     }
     LOG_USER_ERROR(OB_ERR_PRIMARY_KEY_DUPLICATE, rowkey_buffer, index_name.length(), index_name.ptr());
   }
+  if (nullptr != sorted_rows) {
+    run_ctx.allocator_.free(sorted_rows);
+  }
+  return ret;
+}
+
+int ObLSTabletService::sort_rows_by_rowkey(
+    ObDMLRunningCtx &run_ctx,
+    ObStoreRow *rows,
+    const int64_t row_count,
+    ObStoreRow **&sorted_rows)
+{
+  int ret = OB_SUCCESS;
+  const int64_t rowkey_cnt = run_ctx.relative_table_.get_rowkey_column_num();
+  ObSEArray<int64_t, OB_MAX_ROWKEY_COLUMN_NUMBER> sort_column_index;
+  void *buf = nullptr;
+  sorted_rows = nullptr;
+  for (int64_t i = 0; OB_SUCC(ret) && i < rowkey_cnt; ++i) {
+    if (OB_FAIL(sort_column_index.push_back(i))) {
+      LOG_WARN("failed to push back sort column index", K(ret), K(i));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(buf = run_ctx.allocator_.alloc(row_count * sizeof(ObStoreRow *)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc sorted rows", K(ret), K(row_count));
+  } else {
+    sorted_rows = static_cast<ObStoreRow **>(buf);
+    for (int64_t i = 0; i < row_count; ++i) {
+      sorted_rows[i] = rows + i;
+    }
+    ObStoreRowComparer comparer(ret, sort_column_index);
+    std::sort(sorted_rows, sorted_rows + row_count, comparer);
+    if (OB_FAIL(ret)) {
+      LOG_WARN("failed to sort rows", K(ret), K(rowkey_cnt));
+      run_ctx.allocator_.free(sorted_rows);
+      sorted_rows = nullptr;
+    }
+  }
   return ret;
 }
 
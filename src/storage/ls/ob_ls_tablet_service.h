@@ -603,6 +603,11 @@ private:
       ObStoreRow *rows,
       const int64_t row_count,
       ObRowsInfo &rows_info);
+  static int sort_rows_by_rowkey(
+      ObDMLRunningCtx &run_ctx,
+      ObStoreRow *rows,
+      const int64_t row_count,
+      ObStoreRow **&sorted_rows);
   static int insert_lob_col(
       ObDMLRunningCtx &run_ctx,
       const ObColDesc &column,
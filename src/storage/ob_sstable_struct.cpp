@@ -118,11 +118,14 @@ ObSSTableMergeInfo::ObSSTableMergeInfo()
       new_flush_occupy_size_(0),
       original_size_(0),
       compressed_size_(0),
+      compress_time_(0),
+      compress_wait_time_(0),
       macro_block_count_(0),
       multiplexed_macro_block_count_(0),
       new_micro_count_in_new_macro_(0),
       multiplexed_micro_count_in_new_macro_(0),
       total_row_count_(0),
+      multiplexed_row_count_(0),
       incremental_row_count_(0),
       new_flush_data_rate_(0),
       is_full_merge_(false),
@@ -157,9 +160,12 @@ int ObSSTableMergeInfo::add(const ObSSTableMergeInfo &other)
   occupy_size_ += other.occupy_size_;
   original_size_ += other.original_size_;
   compressed_size_ += other.compressed_size_;
+  compress_time_ += other.compress_time_;
+  compress_wait_time_ += other.compress_wait_time_;
   macro_block_count_ += other.macro_block_count_;
   multiplexed_macro_block_count_ += other.multiplexed_macro_block_count_;
   total_row_count_ += other.total_row_count_;
+  multiplexed_row_count_ += other.multiplexed_row_count_;
   incremental_row_count_ += other.incremental_row_count_;
   multiplexed_micro_count_in_new_macro_ += other.multiplexed_micro_count_in_new_macro_;
   new_micro_count_in_new_macro_ += other.new_micro_count_in_new_macro_;
@@ -189,11 +195,14 @@ void ObSSTableMergeInfo::reset()
   new_flush_occupy_size_ = 0;
   original_size_ = 0;
   compressed_size_ = 0;
+  compress_time_ = 0;
+  compress_wait_time_ = 0;
   macro_block_count_ = 0;
   multiplexed_macro_block_count_ = 0;
   new_micro_count_in_new_macro_ = 0;
   multiplexed_micro_count_in_new_macro_ = 0;
   total_row_count_ = 0;
+  multiplexed_row_count_ = 0;
   incremental_row_count_ = 0;
   new_flush_data_rate_ = 0;
   is_full_merge_ = false;
@@ -212,12 +221,27 @@ void ObSSTableMergeInfo::dump_info(const char *msg)
 {
   int64_t output_row_per_s = 0;
   int64_t new_macro_KB_per_s = 0;
+  // percentage of the output reused from the input sstables
+  int64_t macro_reuse_ratio = 0;
+  int64_t micro_reuse_ratio = 0;
+  int64_t row_reuse_ratio = 0;
   if (merge_finish_time_ > merge_start_time_) {
     const int64_t merge_cost_time = merge_finish_time_ - merge_start_time_;
     output_row_per_s = (incremental_row_count_ * 1000 * 1000) / merge_cost_time;
     new_macro_KB_per_s = (macro_block_count_ - multiplexed_macro_block_count_) * 2 * 1024 * 1000 * 1000 / merge_cost_time;
   }
-  FLOG_INFO("dump merge info", K(msg), K(output_row_per_s), K(new_macro_KB_per_s), K(*this));
+  if (macro_block_count_ > 0) {
+    macro_reuse_ratio = multiplexed_macro_block_count_ * 100 / macro_block_count_;
+  }
+  if (new_micro_count_in_new_macro_ + multiplexed_micro_count_in_new_macro_ > 0) {
+    micro_reuse_ratio = multiplexed_micro_count_in_new_macro_ * 100
+        / (new_micro_count_in_new_macro_ + multiplexed_micro_count_in_new_macro_);
+  }
+  if (total_row_count_ > 0) {
+    row_reuse_ratio = multiplexed_row_count_ * 100 / total_row_count_;
+  }
+  FLOG_INFO("dump merge info", K(msg), K(output_row_per_s), K(new_macro_KB_per_s),
+            K(macro_reuse_ratio), K(micro_reuse_ratio), K(row_reuse_ratio), K(*this));
 }
 
 ObMergeChecksumInfo::ObMergeChecksumInfo()
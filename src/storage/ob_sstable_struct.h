@@ -119,9 +119,9 @@ public:
   TO_STRING_KV(K_(tenant_id), K_(ls_id), K_(tablet_id), K_(compaction_scn),
               "merge_type", merge_type_to_str(merge_type_), "merge_cost_time", merge_finish_time_ - merge_start_time_,
                K_(merge_start_time), K_(merge_finish_time), K_(dag_id), K_(occupy_size), K_(new_flush_occupy_size), K_(original_size),
-               K_(compressed_size), K_(macro_block_count), K_(multiplexed_macro_block_count),
+               K_(compressed_size), K_(compress_time), K_(compress_wait_time), K_(macro_block_count), K_(multiplexed_macro_block_count),
                K_(new_micro_count_in_new_macro), K_(multiplexed_micro_count_in_new_macro),
-               K_(total_row_count), K_(incremental_row_count), K_(new_flush_data_rate),
+               K_(total_row_count), K_(multiplexed_row_count), K_(incremental_row_count), K_(new_flush_data_rate),
                K_(is_full_merge), K_(progressive_merge_round), K_(progressive_merge_num),
                K_(concurrent_cnt), K_(parallel_merge_info), K_(filter_statistics), K_(participant_table_str),
                K_(macro_id_list), K_(comment));
@@ -138,11 +138,14 @@ public:
   int64_t new_flush_occupy_size_; 
   int64_t original_size_;
   int64_t compressed_size_;
+  int64_t compress_time_; // time of compressing micro blocks in the compress pool
+  int64_t compress_wait_time_; // time of merge thread waiting for the compress pool
   int64_t macro_block_count_;
   int64_t multiplexed_macro_block_count_;
   int64_t new_micro_count_in_new_macro_;
   int64_t multiplexed_micro_count_in_new_macro_;
   int64_t total_row_count_;
+  int64_t multiplexed_row_count_; // rows in the reused macro and micro blocks
   int64_t incremental_row_count_;
   int64_t new_flush_data_rate_;
   bool is_full_merge_;
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "observer/omt/ob_tenant.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::omt;
+
+class TestTenantToken
+    : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+  }
+
+  virtual void TearDown()
+  {
+  }
+};
+
+TEST_F(TestTenantToken, blocking_worker)
+{
+  const int64_t now = ObTimeUtility::current_time();
+  const int64_t threshold = ObTenant::BLOCKING_WORKER_THRESHOLD;
+  // not waiting
+  ASSERT_FALSE(ObTenant::is_blocking_worker(0, now));
+  ASSERT_FALSE(ObTenant::is_blocking_worker(now, now));
+  ASSERT_FALSE(ObTenant::is_blocking_worker(now - threshold, now));
+  ASSERT_TRUE(ObTenant::is_blocking_worker(now - threshold - 1, now));
+}
+
+TEST_F(TestTenantToken, raise_by_excess)
+{
+  int64_t token_cnt = 10;
+  // 8 of 10 workers blocked, 3 more than half
+  ASSERT_TRUE(ObTenant::raise_token_for_blocking(8, 10, 1, 100, token_cnt));
+  ASSERT_EQ(13, token_cnt);
+  // odd active count, 4 of 5 blocked is 2 more than 5 / 2
+  token_cnt = 5;
+  ASSERT_TRUE(ObTenant::raise_token_for_blocking(4, 5, 100, 100, token_cnt));
+  ASSERT_EQ(7, token_cnt);
+}
+
+TEST_F(TestTenantToken, bounded)
+{
+  int64_t token_cnt = 10;
+  ASSERT_TRUE(ObTenant::raise_token_for_blocking(10, 10, 1, 12, token_cnt));
+  ASSERT_EQ(12, token_cnt);
+  // already at the bound
+  ASSERT_TRUE(ObTenant::raise_token_for_blocking(12, 12, 1, 12, token_cnt));
+  ASSERT_EQ(12, token_cnt);
+}
+
+TEST_F(TestTenantToken, not_raised)
+{
+  int64_t token_cnt = 10;
+  // nothing queued
+  ASSERT_FALSE(ObTenant::raise_token_for_blocking(10, 10, 0, 100, token_cnt));
+  ASSERT_EQ(10, token_cnt);
+  // exactly half blocked
+  ASSERT_FALSE(ObTenant::raise_token_for_blocking(5, 10, 1, 100, token_cnt));
+  ASSERT_EQ(10, token_cnt);
+  // no active worker
+  ASSERT_FALSE(ObTenant::raise_token_for_blocking(0, 0, 1, 100, token_cnt));
+  ASSERT_EQ(10, token_cnt);
+}
+
+int main(int argc, char *argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "observer/table/ob_table_service.h"
+#include "share/table/ob_table.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::table;
+using namespace oceanbase::observer;
+
+class TestTableMultiGetOrder: public ::testing::Test
+{
+public:
+  TestTableMultiGetOrder() {}
+  virtual ~TestTableMultiGetOrder() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  // append a get of (k1, k2) to the batch
+  void add_get(ObTableBatchOperation &batch, const int64_t k1, const ObString &k2)
+  {
+    ObTableEntity entity;
+    ObObj obj;
+    obj.set_int(k1);
+    ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+    obj.set_varchar(k2);
+    obj.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+    ASSERT_EQ(OB_SUCCESS, batch.retrieve(entity));
+  }
+};
+
+TEST_F(TestTableMultiGetOrder, sort_by_rowkey)
+{
+  ObTableEntityFactory<ObTableEntity> entity_factory;
+  ObTableBatchOperation batch;
+  ObSEArray<int64_t, 8> get_order;
+  batch.set_entity_factory(&entity_factory);
+  add_get(batch, 3, "a");
+  add_get(batch, 1, "b");
+  add_get(batch, 2, "b");
+  add_get(batch, 1, "a");
+  add_get(batch, 2, "a");
+
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+  ASSERT_EQ(5, get_order.count());
+  const int64_t expect[] = {3, 1, 4, 2, 0};
+  for (int64_t i = 0; i < get_order.count(); ++i) {
+    ASSERT_EQ(expect[i], get_order.at(i));
+  }
+}
+
+TEST_F(TestTableMultiGetOrder, duplicate_keys_keep_request_order)
+{
+  ObTableEntityFactory<ObTableEntity> entity_factory;
+  ObTableBatchOperation batch;
+  ObSEArray<int64_t, 8> get_order;
+  batch.set_entity_factory(&entity_factory);
+  add_get(batch, 2, "a");
+  add_get(batch, 1, "a");
+  add_get(batch, 2, "a");
+  add_get(batch, 1, "a");
+
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+  const int64_t expect[] = {1, 3, 0, 2};
+  ASSERT_EQ(4, get_order.count());
+  for (int64_t i = 0; i < get_order.count(); ++i) {
+    ASSERT_EQ(expect[i], get_order.at(i));
+  }
+}
+
+TEST_F(TestTableMultiGetOrder, single_key)
+{
+  ObTableEntityFactory<ObTableEntity> entity_factory;
+  ObTableBatchOperation batch;
+  ObSEArray<int64_t, 8> get_order;
+  batch.set_entity_factory(&entity_factory);
+  add_get(batch, 1, "a");
+
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+  ASSERT_EQ(1, get_order.count());
+  ASSERT_EQ(0, get_order.at(0));
+}
+
+TEST_F(TestTableMultiGetOrder, not_comparable_keep_request_order)
+{
+  ObTableEntityFactory<ObTableEntity> entity_factory;
+  ObTableBatchOperation batch;
+  ObSEArray<int64_t, 8> get_order;
+  batch.set_entity_factory(&entity_factory);
+  add_get(batch, 2, "a");
+  add_get(batch, 1, "a");
+  // a collation free key can not be compared with an int key
+  ObTableEntity entity;
+  ObObj obj;
+  obj.set_varchar("x");
+  obj.set_collation_type(CS_TYPE_COLLATION_FREE);
+  ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+  ASSERT_EQ(OB_SUCCESS, batch.retrieve(entity));
+  add_get(batch, 0, "a");
+
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+  ASSERT_EQ(4, get_order.count());
+  for (int64_t i = 0; i < get_order.count(); ++i) {
+    ASSERT_EQ(i, get_order.at(i));
+  }
+}
+
+TEST_F(TestTableMultiGetOrder, many_not_comparable_keep_request_order)
+{
+  // more than 16 keys, std::sort takes the unguarded paths
+  const int64_t KEY_CNT = 40;
+  for (int64_t bad_idx = 0; bad_idx < KEY_CNT; bad_idx += 13) {
+    ObTableEntityFactory<ObTableEntity> entity_factory;
+    ObTableBatchOperation batch;
+    ObSEArray<int64_t, 64> get_order;
+    batch.set_entity_factory(&entity_factory);
+    for (int64_t i = 0; i < KEY_CNT; ++i) {
+      if (i == bad_idx) {
+        ObTableEntity entity;
+        ObObj obj;
+        obj.set_varchar("x");
+        obj.set_collation_type(CS_TYPE_COLLATION_FREE);
+        ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+        ASSERT_EQ(OB_SUCCESS, batch.retrieve(entity));
+      } else {
+        add_get(batch, KEY_CNT - i, "a");
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+    ASSERT_EQ(KEY_CNT, get_order.count());
+    for (int64_t i = 0; i < get_order.count(); ++i) {
+      ASSERT_EQ(i, get_order.at(i));
+    }
+  }
+}
+
+TEST_F(TestTableMultiGetOrder, not_comparable_later_column)
+{
+  // the first columns differ, only keys with the same first column reach the
+  // mismatched second column
+  const int64_t KEY_CNT = 20;
+  ObTableEntityFactory<ObTableEntity> entity_factory;
+  ObTableBatchOperation batch;
+  ObSEArray<int64_t, 32> get_order;
+  batch.set_entity_factory(&entity_factory);
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    ObTableEntity entity;
+    ObObj obj;
+    obj.set_int((KEY_CNT - i) / 2);
+    ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+    obj.set_varchar("a");
+    obj.set_collation_type(0 == i % 2 ? CS_TYPE_UTF8MB4_BIN : CS_TYPE_COLLATION_FREE);
+    ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+    ASSERT_EQ(OB_SUCCESS, batch.retrieve(entity));
+  }
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+  ASSERT_EQ(KEY_CNT, get_order.count());
+  for (int64_t i = 0; i < get_order.count(); ++i) {
+    ASSERT_EQ(i, get_order.at(i));
+  }
+}
+
+TEST_F(TestTableMultiGetOrder, many_keys_with_null)
+{
+  const int64_t KEY_CNT = 20;
+  ObTableEntityFactory<ObTableEntity> entity_factory;
+  ObTableBatchOperation batch;
+  ObSEArray<int64_t, 32> get_order;
+  batch.set_entity_factory(&entity_factory);
+  for (int64_t i = 0; i < KEY_CNT; ++i) {
+    if (5 == i) {
+      ObTableEntity entity;
+      ObObj obj;
+      obj.set_null();
+      ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+      obj.set_varchar("a");
+      obj.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+      ASSERT_EQ(OB_SUCCESS, entity.add_rowkey_value(obj));
+      ASSERT_EQ(OB_SUCCESS, batch.retrieve(entity));
+    } else {
+      add_get(batch, KEY_CNT - i, "a");
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, ObTableService::sort_multi_get_keys(batch, get_order));
+  ASSERT_EQ(KEY_CNT, get_order.count());
+  // null is the smallest, the others are in descending request order
+  ASSERT_EQ(5, get_order.at(0));
+  for (int64_t i = 1; i < get_order.count(); ++i) {
+    const int64_t expect = i < KEY_CNT - 5 ? KEY_CNT - i : KEY_CNT - i - 1;
+    ASSERT_EQ(expect, get_order.at(i));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -1355,6 +1355,48 @@ TEST_F(TestDagScheduler, test_get_dag_count)
   EXPECT_EQ(-1, scheduler->get_dag_count(ObDagType::DAG_TYPE_MAX));
 }
 
+TEST_F(TestDagScheduler, test_schedule_stat)
+{
+  ObTenantDagScheduler *scheduler = MTL(ObTenantDagScheduler*);
+  ASSERT_TRUE(nullptr != scheduler);
+  ASSERT_EQ(OB_SUCCESS, scheduler->init(MTL_ID(), time_slice));
+
+  int64_t counter = 1;
+  int64_t prio = 0;
+  for (int64_t i = 0; i < 2; ++i) {
+    TestMPDag *dag = NULL;
+    TestMulTask *mul_task = NULL;
+    EXPECT_EQ(OB_SUCCESS, scheduler->alloc_dag(dag));
+    EXPECT_EQ(OB_SUCCESS, dag->init(i + 1));
+    EXPECT_EQ(OB_SUCCESS, dag->alloc_task(mul_task));
+    EXPECT_EQ(OB_SUCCESS, mul_task->init(&counter));
+    EXPECT_EQ(OB_SUCCESS, dag->add_task(*mul_task));
+    prio = dag->get_priority();
+    EXPECT_EQ(OB_SUCCESS, scheduler->add_dag(dag));
+  }
+  wait_scheduler();
+
+  int64_t hist_cnt = 0;
+  for (int64_t i = 0; i < ObTenantDagScheduler::QUEUE_WAIT_HIST_BUCKET_CNT; ++i) {
+    hist_cnt += scheduler->queue_wait_hists_[prio][i];
+  }
+  EXPECT_EQ(2, scheduler->scheduled_dag_cnts_[ObDagType::DAG_TYPE_MAJOR_MERGE]);
+  EXPECT_EQ(2, hist_cnt);
+  EXPECT_LE(2, scheduler->dispatch_task_cnts_[prio]);
+
+  ObArenaAllocator allocator;
+  ObArray<void *> scheduler_infos;
+  EXPECT_EQ(OB_SUCCESS, scheduler->get_all_dag_scheduler_info(allocator, scheduler_infos));
+  int64_t queue_wait_hist_cnt = 0;
+  for (int64_t i = 0; i < scheduler_infos.count(); ++i) {
+    ObDagSchedulerInfo *info = static_cast<ObDagSchedulerInfo *>(scheduler_infos.at(i));
+    if (ObDagSchedulerInfo::QUEUE_WAIT_HIST == info->value_type_) {
+      ++queue_wait_hist_cnt;
+    }
+  }
+  EXPECT_EQ(ObDagPrio::DAG_PRIO_MAX * ObTenantDagScheduler::QUEUE_WAIT_HIST_BUCKET_CNT, queue_wait_hist_cnt);
+}
+
 TEST_F(TestDagScheduler, test_destroy_when_running)
 {
   ObTenantDagScheduler *scheduler = MTL(ObTenantDagScheduler*);
@@ -1124,6 +1124,37 @@ TEST_F(TestJsonBase, test_seek)
   ASSERT_EQ(OB_SUCCESS, j_base->print(j_buf, false));
   cout << j_buf.ptr() << endl;
   ASSERT_EQ(0, strncmp("true", j_buf.ptr(), j_buf.length()));
+
+  // 11. seek member and array cell chain, tree and bin should be the same
+  common::ObString j_text11("{\"a\": [1, {\"b\": [\"x\", \"y\", {\"c\": \"z\"}]}], \"d\": \"w\"}");
+  ASSERT_EQ(OB_SUCCESS, ObJsonBaseFactory::get_json_base(&allocator, j_text11,
+      ObJsonInType::JSON_TREE, ObJsonInType::JSON_TREE, j_tree));
+  ASSERT_EQ(OB_SUCCESS, ObJsonBaseFactory::transform(&allocator, j_tree,
+      ObJsonInType::JSON_BIN, j_bin));
+  const char *path_texts11[] = {"$.a[1].b[2].c", "$.a[1].b[last]", "$.a[last].b[1]", "$.a[5]",
+                                "$.a[1].c", "$.d[0]", "$.d[0][0]", "$.d[1]", "$[0].d", "$.a.b"};
+  const int64_t hit_cnts11[] = {1, 1, 1, 0, 0, 1, 1, 0, 1, 0};
+  for (int64_t i = 0; i < sizeof(hit_cnts11) / sizeof(hit_cnts11[0]); i++) {
+    common::ObString path_text11(path_texts11[i]);
+    ObJsonPath j_path11(path_text11, &allocator);
+    ASSERT_EQ(OB_SUCCESS, j_path11.parse_path());
+    ObJsonBuffer tree_buf(&allocator);
+    ObJsonBuffer bin_buf(&allocator);
+    hit.reset();
+    ASSERT_EQ(OB_SUCCESS, j_tree->seek(j_path11, j_path11.path_node_cnt(), true, false, hit));
+    ASSERT_EQ(hit_cnts11[i], hit.size());
+    if (hit.size() > 0) {
+      ASSERT_EQ(OB_SUCCESS, hit[0]->print(tree_buf, true));
+    }
+    hit.reset();
+    ASSERT_EQ(OB_SUCCESS, j_bin->seek(j_path11, j_path11.path_node_cnt(), true, false, hit));
+    ASSERT_EQ(hit_cnts11[i], hit.size());
+    if (hit.size() > 0) {
+      ASSERT_EQ(OB_SUCCESS, hit[0]->print(bin_buf, true));
+      ASSERT_EQ(0, strncmp(tree_buf.ptr(), bin_buf.ptr(), tree_buf.length()));
+      ASSERT_EQ(tree_buf.length(), bin_buf.length());
+    }
+  }
 }
 
 TEST_F(TestJsonBase, test_print)
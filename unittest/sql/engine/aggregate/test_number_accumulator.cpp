@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/aggregate/ob_aggregate_processor.h"
+#include "lib/allocator/page_arena.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace common::number;
+using namespace sql;
+
+// The batch sum of number_accumulator must be the same as adding the numbers one by one
+// with ObNumber::add_v3.
+class TestNumberAccumulator: public ::testing::Test
+{
+public:
+  static const int64_t MAX_ROW_CNT = 32;
+  TestNumberAccumulator() {}
+  virtual ~TestNumberAccumulator() {}
+  virtual void SetUp() {}
+  virtual void TearDown() { allocator_.reset(); }
+protected:
+  void check_sum(const char **nums, const int64_t cnt, const char *init = nullptr)
+  {
+    ObDatum datums[MAX_ROW_CNT];
+    uint16_t selector_array[MAX_ROW_CNT];
+    ObNumber expect;
+    ObNumber value;
+    ASSERT_LE(cnt, MAX_ROW_CNT);
+    if (nullptr != init) {
+      ASSERT_EQ(OB_SUCCESS, expect.from(init, allocator_));
+    }
+    ObNumber result = expect;
+    for (int64_t i = 0; i < cnt; ++i) {
+      ObNumber num;
+      ASSERT_EQ(OB_SUCCESS, num.from(nums[i], allocator_));
+      datums[i].ptr_ = static_cast<char *>(allocator_.alloc(ObNumber::MAX_BYTE_LEN));
+      ASSERT_TRUE(nullptr != datums[i].ptr_);
+      datums[i].set_number(num);
+      selector_array[i] = static_cast<uint16_t>(i);
+      ASSERT_EQ(OB_SUCCESS, expect.add_v3(num, value, allocator_));
+      expect = value;
+    }
+
+    ObDatumVector src;
+    src.datums_ = datums;
+    src.set_batch(true);
+    ObAggregateProcessor::ObSelector selector(nullptr, selector_array, static_cast<uint16_t>(cnt));
+    char buf_alloc1[ObNumber::MAX_CALC_BYTE_LEN];
+    char buf_alloc2[ObNumber::MAX_CALC_BYTE_LEN];
+    uint32_t sum_digits_buf[ObNumber::OB_CALC_BUFFER_SIZE];
+    MEMSET(sum_digits_buf, 0, ObNumber::MAX_CALC_BYTE_LEN);
+    ObDataBuffer allocator1(buf_alloc1, ObNumber::MAX_CALC_BYTE_LEN);
+    ObDataBuffer allocator2(buf_alloc2, ObNumber::MAX_CALC_BYTE_LEN);
+    bool all_skip = true;
+    ASSERT_EQ(OB_SUCCESS, ObAggregateProcessor::number_accumulator(
+        src, allocator1, allocator2, result, sum_digits_buf, all_skip, selector));
+    ASSERT_FALSE(all_skip);
+    SQL_ENG_LOG(INFO, "number accumulator", K(result), K(expect));
+    ASSERT_EQ(0, result.compare(expect));
+    ASSERT_EQ(expect.is_zero(), result.is_zero());
+  }
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestNumberAccumulator, mixed_signs)
+{
+  const char *nums[] = {"1.5", "-2.25", "3", "-0.75", "100", "-0.000000001", "0.3", "-7"};
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]));
+  // added to the result of the previous batches
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]), "-5.5");
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]), "12345.678");
+  // one sign only
+  const char *negatives[] = {"-1.5", "-0.25", "-3"};
+  check_sum(negatives, sizeof(negatives) / sizeof(negatives[0]));
+  check_sum(negatives, sizeof(negatives) / sizeof(negatives[0]), "4.75");
+}
+
+TEST_F(TestNumberAccumulator, cancel_to_zero)
+{
+  const char *nums[] = {"1.5", "-1.5", "7", "-7", "0.000000001", "-0.000000001"};
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]));
+  const char *to_zero[] = {"2.5", "-1.25", "-1"};
+  check_sum(to_zero, sizeof(to_zero) / sizeof(to_zero[0]), "-0.25");
+}
+
+TEST_F(TestNumberAccumulator, carries)
+{
+  // the fragments carry into the integer digit, which carries into a new digit
+  const char *decimals[] = {"999999999.999999999", "999999999.999999999", "999999999.999999999",
+                            "0.5", "0.5", "-999999999.999999999", "-999999999.5"};
+  check_sum(decimals, sizeof(decimals) / sizeof(decimals[0]));
+  // fragments only
+  const char *fragments[] = {"0.999999999", "0.999999999", "0.000000002", "-0.5", "-0.5"};
+  check_sum(fragments, sizeof(fragments) / sizeof(fragments[0]));
+  // integers only, carry to exactly 1e9
+  const char *integers[] = {"999999999", "1", "-999999999", "-1", "-999999999"};
+  check_sum(integers, sizeof(integers) / sizeof(integers[0]));
+}
+
+TEST_F(TestNumberAccumulator, overflow_fallback)
+{
+  // a long number after the accumulated ones falls back to add_v3 for the whole batch
+  const char *nums[] = {"1.5", "-2", "123456789012345678901234567890.123456789", "-0.5",
+                        "-123456789012345678901234567890.123456789", "3"};
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]));
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]), "-99.99");
+}
+
+TEST_F(TestNumberAccumulator, different_exponents)
+{
+  // numbers out of the fast shapes are added by add_v3 and merged with the integer sums
+  const char *nums[] = {"1000000000000", "0.0000000001", "-12345678901.5", "2.5",
+                        "-0.000000000000000001", "1000000000", "-3", "0.25"};
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]));
+  check_sum(nums, sizeof(nums) / sizeof(nums[0]), "100000000000000000000");
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -305,6 +305,78 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+TEST_F(TestParser, find_special_char)
+{
+  ObCSVSpecialChars chars;
+  ASSERT_TRUE(chars.add(','));
+  ASSERT_TRUE(chars.add('\n'));
+  ASSERT_TRUE(chars.add('\\'));
+  ASSERT_TRUE(chars.add(','));
+  ASSERT_TRUE(chars.add('"'));
+  ASSERT_FALSE(chars.add('|'));
+  ASSERT_EQ(4, chars.cnt_);
+
+  // the avx2 version is only run on the hosts supporting it
+  const ObCSVFindSpecialCharFunc find_func = get_find_csv_special_char_func();
+  char buf[256];
+  for (int64_t len = 0; len < static_cast<int64_t>(sizeof(buf)); ++len) {
+    MEMSET(buf, 'a', sizeof(buf));
+    // no special char
+    ASSERT_EQ(buf + len, find_csv_special_char(buf, buf + len, chars));
+    ASSERT_EQ(buf + len, find_func(buf, buf + len, chars));
+    // special char at every position
+    for (int64_t pos = 0; pos < len; ++pos) {
+      buf[pos] = chars.chars_[pos % ObCSVSpecialChars::MAX_CHAR_CNT];
+      ASSERT_EQ(buf + pos, find_csv_special_char(buf, buf + len, chars));
+      ASSERT_EQ(buf + pos, find_func(buf, buf + len, chars));
+      buf[pos] = 'a';
+    }
+  }
+}
+
+TEST_F(TestParser, general_parser_skip_plain_bytes)
+{
+  ObDataInFileStruct file_struct;
+  file_struct.field_term_str_ = ",";
+  file_struct.line_term_str_ = "\n";
+  file_struct.field_enclosed_str_ = "\"";
+  file_struct.field_enclosed_char_ = '"';
+  file_struct.field_escaped_char_ = '\\';
+
+  ObCSVGeneralParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, 3, CS_TYPE_UTF8MB4_BIN));
+  ASSERT_TRUE(nullptr != parser.get_opt_params().find_special_char_);
+
+  const char data[] = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa,\"b,\"\"b\",c\\,c\n"
+                      "\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87,2,\\N\n";
+  char escape_buf[sizeof(data)];
+  const char *ptr = data;
+  const char *end = data + strlen(data);
+  int64_t nrows = 2;
+  ObSEArray<ObCSVGeneralParser::LineErrRec, 1> errors;
+  ObSEArray<ObString, 6> values;
+  auto collect = [&](ObIArray<ObCSVGeneralParser::FieldValue> &fields) -> int {
+    for (int64_t i = 0; i < fields.count(); ++i) {
+      values.push_back(fields.at(i).is_null_ ? ObString("NULL")
+                                             : ObString(fields.at(i).len_, fields.at(i).ptr_));
+    }
+    return OB_SUCCESS;
+  };
+  ASSERT_EQ(OB_SUCCESS, (parser.scan<decltype(collect), true>(ptr, end, nrows,
+                                     escape_buf, escape_buf + sizeof(escape_buf),
+                                     collect, errors, true)));
+  ASSERT_EQ(2, nrows);
+  ASSERT_EQ(0, errors.count());
+  ASSERT_EQ(end, ptr);
+  ASSERT_EQ(6, values.count());
+  ASSERT_EQ(ObString("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"), values.at(0));
+  ASSERT_EQ(ObString("b,\"b"), values.at(1));
+  ASSERT_EQ(ObString("c,c"), values.at(2));
+  ASSERT_EQ(ObString("\xe4\xb8\xad\xe6\x96\x87\xe4\xb8\xad\xe6\x96\x87"), values.at(3));
+  ASSERT_EQ(ObString("2"), values.at(4));
+  ASSERT_EQ(ObString("NULL"), values.at(5));
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
@@ -189,6 +189,49 @@ TEST_F(ObRoutePolicyTest, ONLY_READONLY_ZONE)
   }
 }
 
+TEST_F(ObRoutePolicyTest, READONLY_REPLICA_FIRST)
+{
+  route_policy_ctx_.policy_type_ = READONLY_ZONE_FIRST;
+  route_policy_ctx_.consistency_level_ = WEAK;
+  ObArray<ObRoutePolicy::CandidateReplica> candi_replicas;
+  replica_idx_ = 0;
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::OTHER_REGION, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::SAME_IDC, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::SAME_REGION, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::SAME_IDC, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  candi_replicas.at(0).attr_.replica_type_ = REPLICA_TYPE_READONLY;
+  candi_replicas.at(1).attr_.replica_type_ = REPLICA_TYPE_FULL;
+  candi_replicas.at(2).attr_.replica_type_ = REPLICA_TYPE_READONLY;
+  candi_replicas.at(3).attr_.replica_type_ = REPLICA_TYPE_READONLY;
+  ASSERT_EQ(OB_SUCCESS, route_policy_.calculate_replica_priority(candi_replicas, route_policy_ctx_));
+  LOG_INFO("READONLY_REPLICA_FIRST sort result", K(candi_replicas));
+  // the position goes first, the read only replica goes before the full replica in the same idc
+  ASSERT_EQ(3, candi_replicas.at(0).replica_idx_);
+  ASSERT_EQ(1, candi_replicas.at(1).replica_idx_);
+  ASSERT_EQ(2, candi_replicas.at(2).replica_idx_);
+  ASSERT_EQ(0, candi_replicas.at(3).replica_idx_);
+}
+
+TEST_F(ObRoutePolicyTest, SAME_SERVER_FULL_REPLICA_FIRST)
+{
+  route_policy_ctx_.policy_type_ = READONLY_ZONE_FIRST;
+  route_policy_ctx_.consistency_level_ = WEAK;
+  ObArray<ObRoutePolicy::CandidateReplica> candi_replicas;
+  replica_idx_ = 0;
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::SAME_IDC, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::SAME_REGION, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  ASSERT_EQ(OB_SUCCESS, add_candi_replica(candi_replicas, ObRoutePolicy::SAME_SERVER, ObRoutePolicy::NOMERGING, ZONE_TYPE_READWRITE, ObZoneStatus::ACTIVE));
+  candi_replicas.at(0).attr_.replica_type_ = REPLICA_TYPE_READONLY;
+  candi_replicas.at(1).attr_.replica_type_ = REPLICA_TYPE_READONLY;
+  candi_replicas.at(2).attr_.replica_type_ = REPLICA_TYPE_FULL;
+  ASSERT_EQ(OB_SUCCESS, route_policy_.calculate_replica_priority(candi_replicas, route_policy_ctx_));
+  LOG_INFO("SAME_SERVER_FULL_REPLICA_FIRST sort result", K(candi_replicas));
+  // the full replica on the same server is not given up for a remote read only replica
+  ASSERT_EQ(2, candi_replicas.at(0).replica_idx_);
+  ASSERT_EQ(0, candi_replicas.at(1).replica_idx_);
+  ASSERT_EQ(1, candi_replicas.at(2).replica_idx_);
+}
+
 TEST_F(ObRoutePolicyTest, SELECT_INTERSECT_SAME_IDC)
 {
   route_policy_ctx_.policy_type_ = READONLY_ZONE_FIRST;
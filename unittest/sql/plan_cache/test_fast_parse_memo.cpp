@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/plan_cache/ob_fast_parse_memo.h"
+#include "sql/plan_cache/ob_sql_parameterization.h"
+#include "sql/plan_cache/ob_plan_cache_struct.h"
+#include "lib/allocator/page_arena.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace sql;
+
+class TestFastParseMemo: public ::testing::Test
+{
+public:
+  TestFastParseMemo() {}
+  virtual ~TestFastParseMemo() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  static ObFastParseMemoKey make_key(const ObString &sql,
+                                     const uint64_t tenant_id = OB_SERVER_TENANT_ID,
+                                     const ObSQLMode sql_mode = SMO_DEFAULT)
+  {
+    return ObFastParseMemoKey(tenant_id, sql, sql_mode, ObCharset::get_system_collation(),
+                              false, false);
+  }
+  static int fast_parse(ObIAllocator &allocator, const ObString &sql, ObFastParserResult &fp_result)
+  {
+    return ObSqlParameterization::fast_parser(allocator, SMO_DEFAULT,
+                                              ObCharset::get_system_collation(),
+                                              sql, false, fp_result);
+  }
+  static void check_same_params(const ObFastParserResult &expect, const ObFastParserResult &actual)
+  {
+    ASSERT_EQ(expect.pc_key_.name_, actual.pc_key_.name_);
+    ASSERT_EQ(expect.raw_params_.count(), actual.raw_params_.count());
+    for (int64_t i = 0; i < expect.raw_params_.count(); ++i) {
+      const ParseNode *e = expect.raw_params_.at(i)->node_;
+      const ParseNode *a = actual.raw_params_.at(i)->node_;
+      ASSERT_EQ(e->type_, a->type_);
+      ASSERT_EQ(e->value_, a->value_);
+      ASSERT_EQ(e->str_len_, a->str_len_);
+      ASSERT_EQ(e->text_len_, a->text_len_);
+      ASSERT_EQ(e->pos_, a->pos_);
+      ASSERT_EQ(nullptr == e->str_value_, nullptr == a->str_value_);
+      if (e->str_len_ > 0) {
+        ASSERT_EQ(0, MEMCMP(e->str_value_, a->str_value_, e->str_len_));
+      }
+    }
+  }
+};
+
+TEST_F(TestFastParseMemo, hit)
+{
+  ObArenaAllocator parse_allocator;
+  ObArenaAllocator allocator;
+  ObFastParseMemo memo;
+  ObFastParserResult fp_result;
+  ObFastParserResult memo_result;
+  bool is_hit = false;
+  ObString sql = ObString::make_string("select * from t1 where c1 = 3 and c2 = 'abc'");
+  ObFastParseMemoKey key = make_key(sql);
+
+  ASSERT_EQ(OB_SUCCESS, memo.get(key, allocator, memo_result, is_hit));
+  ASSERT_FALSE(is_hit);
+  ASSERT_EQ(OB_SUCCESS, fast_parse(parse_allocator, sql, fp_result));
+  ASSERT_EQ(2, fp_result.raw_params_.count());
+  ASSERT_EQ(OB_SUCCESS, memo.put(key, fp_result));
+
+  ASSERT_EQ(OB_SUCCESS, memo.get(key, allocator, memo_result, is_hit));
+  ASSERT_TRUE(is_hit);
+  check_same_params(fp_result, memo_result);
+  ASSERT_EQ(3, memo_result.raw_params_.at(0)->node_->value_);
+}
+
+TEST_F(TestFastParseMemo, empty_string_literal)
+{
+  ObArenaAllocator *parse_allocator = OB_NEW(ObArenaAllocator, "TestFPMemo");
+  ObArenaAllocator allocator;
+  ObFastParseMemo memo;
+  ObFastParserResult fp_result;
+  ObFastParserResult memo_result;
+  bool is_hit = false;
+  ObString sql = ObString::make_string("select * from t1 where c1 = '' and c2 = 1");
+  ObFastParseMemoKey key = make_key(sql);
+
+  ASSERT_TRUE(nullptr != parse_allocator);
+  ASSERT_EQ(OB_SUCCESS, fast_parse(*parse_allocator, sql, fp_result));
+  ASSERT_EQ(2, fp_result.raw_params_.count());
+  ASSERT_EQ(0, fp_result.raw_params_.at(0)->node_->str_len_);
+  ASSERT_EQ(OB_SUCCESS, memo.put(key, fp_result));
+
+  // no memorized pointer refers to the memory of the parse allocator
+  const ObFastParseMemo::Entry *entry = nullptr;
+  for (int64_t i = 0; i < ObFastParseMemo::MAX_ENTRY_CNT; ++i) {
+    if (memo.entries_[i].key_ == key) {
+      entry = &memo.entries_[i];
+    }
+  }
+  ASSERT_TRUE(nullptr != entry);
+  ASSERT_EQ(2, entry->param_cnt_);
+  for (int64_t i = 0; i < entry->param_cnt_; ++i) {
+    const ParseNode *src = fp_result.raw_params_.at(i)->node_;
+    const ParseNode *dst = entry->params_[i];
+    ASSERT_NE(src, dst);
+    ASSERT_EQ(nullptr == src->str_value_, nullptr == dst->str_value_);
+    ASSERT_EQ(nullptr == src->raw_text_, nullptr == dst->raw_text_);
+    if (nullptr != src->str_value_) {
+      ASSERT_NE(src->str_value_, dst->str_value_);
+    }
+    if (nullptr != src->raw_text_) {
+      ASSERT_NE(src->raw_text_, dst->raw_text_);
+    }
+    if (0 == src->num_child_) {
+      ASSERT_TRUE(nullptr == dst->children_);
+    }
+  }
+
+  // the result is still usable after the parse memory is freed
+  fp_result.reset();
+  parse_allocator->reset();
+  OB_DELETE(ObArenaAllocator, "TestFPMemo", parse_allocator);
+  ASSERT_EQ(OB_SUCCESS, memo.get(key, allocator, memo_result, is_hit));
+  ASSERT_TRUE(is_hit);
+  ASSERT_EQ(2, memo_result.raw_params_.count());
+  ASSERT_EQ(0, memo_result.raw_params_.at(0)->node_->str_len_);
+  ASSERT_EQ(1, memo_result.raw_params_.at(1)->node_->value_);
+}
+
+TEST_F(TestFastParseMemo, miss)
+{
+  ObArenaAllocator parse_allocator;
+  ObArenaAllocator allocator;
+  ObFastParseMemo memo;
+  ObFastParserResult fp_result;
+  ObFastParserResult memo_result;
+  bool is_hit = false;
+  ObString sql = ObString::make_string("select * from t1 where c1 = 3");
+  ObString other_param_sql = ObString::make_string("select * from t1 where c1 = 4");
+
+  ASSERT_EQ(OB_SUCCESS, fast_parse(parse_allocator, sql, fp_result));
+  ASSERT_EQ(OB_SUCCESS, memo.put(make_key(sql), fp_result));
+
+  // parameter changed
+  ASSERT_EQ(OB_SUCCESS, memo.get(make_key(other_param_sql), allocator, memo_result, is_hit));
+  ASSERT_FALSE(is_hit);
+  // sql mode changed
+  ASSERT_EQ(OB_SUCCESS, memo.get(make_key(sql, OB_SERVER_TENANT_ID, SMO_ANSI_QUOTES),
+                                 allocator, memo_result, is_hit));
+  ASSERT_FALSE(is_hit);
+  // another tenant
+  ASSERT_EQ(OB_SUCCESS, memo.get(make_key(sql, OB_SYS_TENANT_ID), allocator, memo_result, is_hit));
+  ASSERT_FALSE(is_hit);
+
+  ASSERT_EQ(OB_SUCCESS, memo.get(make_key(sql), allocator, memo_result, is_hit));
+  ASSERT_TRUE(is_hit);
+  ASSERT_EQ(3, memo_result.raw_params_.at(0)->node_->value_);
+}
+
+TEST_F(TestFastParseMemo, evict)
+{
+  ObArenaAllocator parse_allocator;
+  ObArenaAllocator allocator;
+  ObFastParseMemo memo;
+  ObFastParserResult memo_result;
+  bool is_hit = false;
+  char sqls[ObFastParseMemo::MAX_ENTRY_CNT + 1][64];
+  for (int64_t i = 0; i <= ObFastParseMemo::MAX_ENTRY_CNT; ++i) {
+    ObFastParserResult fp_result;
+    snprintf(sqls[i], sizeof(sqls[i]), "select * from t1 where c1 = %ld", i);
+    ObString sql = ObString::make_string(sqls[i]);
+    ASSERT_EQ(OB_SUCCESS, fast_parse(parse_allocator, sql, fp_result));
+    ASSERT_EQ(OB_SUCCESS, memo.put(make_key(sql), fp_result));
+  }
+  // the oldest entry is replaced
+  ASSERT_EQ(OB_SUCCESS, memo.get(make_key(ObString::make_string(sqls[0])),
+                                 allocator, memo_result, is_hit));
+  ASSERT_FALSE(is_hit);
+  for (int64_t i = 1; i <= ObFastParseMemo::MAX_ENTRY_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, memo.get(make_key(ObString::make_string(sqls[i])),
+                                   allocator, memo_result, is_hit));
+    ASSERT_TRUE(is_hit);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
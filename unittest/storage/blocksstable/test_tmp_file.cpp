@@ -643,6 +643,108 @@ TEST_F(TestTmpFile, test_big_file)
   ObTmpFileManager::get_instance().remove(fd);
 }
 
+TEST_F(TestTmpFile, test_read_ahead)
+{
+  int ret = OB_SUCCESS;
+  int64_t dir = -1;
+  int64_t fd = -1;
+  const int64_t macro_block_size = OB_SERVER_BLOCK_MGR.get_macro_block_size();
+  const int64_t page_size = ObTmpMacroBlock::get_default_page_size();
+  const int64_t read_size = 64 * 1024;
+  ObTmpFileIOInfo io_info;
+  ObTmpFileIOHandle handle;
+  ret = ObTmpFileManager::get_instance().alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().open(fd, dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  // large enough for the first blocks to be washed to disk
+  int64_t write_size = macro_block_size * 512;
+  char *write_buf = (char *)malloc(write_size);
+  for (int64_t i = 0; i < write_size; ++i) {
+    write_buf[i] = static_cast<char>(i % 256);
+  }
+  char *read_buf = (char *)malloc(read_size);
+  io_info.fd_ = fd;
+  io_info.tenant_id_ = 1;
+  io_info.io_desc_.set_category(ObIOCategory::USER_IO);
+  io_info.io_desc_.set_wait_event(2);
+  io_info.buf_ = write_buf;
+  io_info.size_ = write_size;
+  const int64_t timeout_ms = 5000;
+  ret = ObTmpFileManager::get_instance().write(io_info, timeout_ms);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  io_info.buf_ = read_buf;
+  io_info.size_ = read_size;
+
+  ObTmpFileHandle file_handle;
+  ASSERT_EQ(OB_SUCCESS, ObTmpFileManager::get_instance().get_tmp_file_handle(fd, file_handle));
+  ObTmpFile *file = file_handle.get_resource_ptr();
+  ASSERT_TRUE(nullptr != file);
+  ObTmpTenantFileStoreHandle store_handle;
+  OB_TMP_FILE_STORE.get_store(1, store_handle);
+  ObTmpTenantFileStore *store = store_handle.get_tenant_store();
+
+  // find an extent on disk and not in the block cache, large enough for the read ahead window
+  ObTmpFileExtent *extent = nullptr;
+  common::ObIArray<ObTmpFileExtent *> &extents = file->file_meta_.get_extents();
+  for (int64_t i = 0; nullptr == extent && i < extents.count(); ++i) {
+    ObTmpMacroBlock *block = nullptr;
+    ObTmpBlockValueHandle tb_handle;
+    ObTmpFileExtent *tmp = extents.at(i);
+    ASSERT_EQ(OB_SUCCESS, store->tmp_block_manager_.get_macro_block(tmp->get_block_id(), block));
+    if (block->is_disked() && OB_SUCCESS != block->get_block_cache_handle(tb_handle)
+        && tmp->get_global_end() - tmp->get_global_start() >= 2 * read_size + ObTmpFile::MIN_READ_AHEAD_SIZE) {
+      extent = tmp;
+    }
+  }
+  ASSERT_TRUE(nullptr != extent);
+  const int64_t start = extent->get_global_start();
+
+  // the read ahead starts from the second sequential read
+  ret = ObTmpFileManager::get_instance().pread(io_info, start, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().pread(io_info, start + read_size, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + start + read_size, read_size));
+  ASSERT_LT(0, file->read_ahead_io_cnt_);
+  int64_t inflight_cnt = 0;
+  for (int64_t i = 0; i < ObTmpFile::MAX_READ_AHEAD_IO_CNT; ++i) {
+    ObMacroBlockHandle &mb_handle = file->read_ahead_handles_[i];
+    if (!mb_handle.get_io_handle().is_empty()) {
+      ASSERT_EQ(OB_SUCCESS, mb_handle.wait(timeout_ms));
+      ++inflight_cnt;
+    }
+  }
+  ASSERT_LT(0, inflight_cnt);
+
+  // the pages read ahead are in the page cache
+  const int64_t read_ahead_start = start + 2 * read_size;
+  const int64_t read_ahead_end = read_ahead_start + ObTmpFile::MIN_READ_AHEAD_SIZE;
+  for (int64_t offset = read_ahead_start; offset < read_ahead_end; offset += page_size) {
+    const int64_t page_id = (extent->get_start_page_id() * page_size + offset - start) / page_size;
+    ObTmpPageCacheKey key(extent->get_block_id(), page_id, 1);
+    ObTmpPageValueHandle p_handle;
+    ASSERT_EQ(OB_SUCCESS, ObTmpPageCache::get_instance().get_page(key, p_handle));
+  }
+
+  // the io buffers are released once the pages are cached
+  file->release_finished_read_ahead();
+  for (int64_t i = 0; i < ObTmpFile::MAX_READ_AHEAD_IO_CNT; ++i) {
+    ASSERT_TRUE(file->read_ahead_handles_[i].get_io_handle().is_empty());
+  }
+
+  // and the sequential read is served from the page cache
+  ret = ObTmpFileManager::get_instance().pread(io_info, read_ahead_start, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(read_size, handle.get_data_size());
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_ahead_start, read_size));
+
+  free(write_buf);
+  free(read_buf);
+  file_handle.reset();
+  ObTmpFileManager::get_instance().remove(fd);
+}
+
 TEST_F(TestTmpFile, test_multi_small_file_single_thread_read_write)
 {
   int ret = OB_SUCCESS;
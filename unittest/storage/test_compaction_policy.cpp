@@ -879,6 +879,155 @@ TEST_F(TestCompactionPolicy, check_no_need_major_merge)
   ASSERT_EQ(OB_NO_NEED_MERGE, ret);
 }
 
+// replay a freeze trace, each freeze dumps a mini sstable with the given row count
+static void simulate_minor_merge(
+    const int64_t *freeze_trace,
+    const int64_t freeze_cnt,
+    const int64_t tier_width,
+    const int64_t max_read_amplification,
+    int64_t &write_amplification,
+    int64_t &max_table_cnt)
+{
+  ObSEArray<int64_t, 64> table_sizes;
+  int64_t write_rows = 0;
+  int64_t ingest_rows = 0;
+  max_table_cnt = 0;
+  for (int64_t i = 0; i < freeze_cnt; ++i) {
+    ingest_rows += freeze_trace[i];
+    write_rows += freeze_trace[i];
+    ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(freeze_trace[i]));
+    bool merged = true;
+    while (merged) {
+      int64_t start_idx = 0;
+      int64_t end_idx = 0;
+      merged = false;
+      if (0 == tier_width) {
+        // leveled, all the sstables are merged when minor_compact_trigger is exceeded
+        if (table_sizes.count() > ObPartitionMergePolicy::DEFAULT_MINOR_COMPACT_TRIGGER) {
+          end_idx = table_sizes.count();
+        }
+      } else {
+        ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::find_tiered_merge_range(
+            table_sizes, tier_width, max_read_amplification, start_idx, end_idx));
+      }
+      if (end_idx - start_idx > 1) {
+        int64_t merged_size = 0;
+        for (int64_t j = start_idx; j < end_idx; ++j) {
+          merged_size += table_sizes.at(j);
+        }
+        write_rows += merged_size;
+        for (int64_t j = end_idx - 1; j > start_idx; --j) {
+          ASSERT_EQ(OB_SUCCESS, table_sizes.remove(j));
+        }
+        table_sizes.at(start_idx) = merged_size;
+        merged = true;
+      }
+    }
+    max_table_cnt = MAX(max_table_cnt, table_sizes.count());
+  }
+  write_amplification = write_rows * 100 / ingest_rows;
+}
+
+TEST_F(TestCompactionPolicy, find_tiered_merge_range)
+{
+  ObSEArray<int64_t, 16> table_sizes;
+  int64_t start_idx = 0;
+  int64_t end_idx = 0;
+  const int64_t sizes[] = {40000, 9000, 1000, 1100, 900};
+  for (int64_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(OB_SUCCESS, table_sizes.push_back(sizes[i]));
+  }
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObPartitionMergePolicy::find_tiered_merge_range(table_sizes, 1, 16, start_idx, end_idx));
+  // the newest three sstables make up a tier
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::find_tiered_merge_range(table_sizes, 3, 16, start_idx, end_idx));
+  ASSERT_EQ(2, start_idx);
+  ASSERT_EQ(5, end_idx);
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::find_tiered_merge_range(table_sizes, 4, 16, start_idx, end_idx));
+  ASSERT_EQ(0, end_idx - start_idx);
+  // too many sstables for point get, merge all
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::find_tiered_merge_range(table_sizes, 4, 4, start_idx, end_idx));
+  ASSERT_EQ(0, start_idx);
+  ASSERT_EQ(5, end_idx);
+}
+
+TEST_F(TestCompactionPolicy, refine_tiered_minor_merge_result)
+{
+  ObSEArray<ObTableHandleV2, 4> major_tables;
+  ObSEArray<ObTableHandleV2, 4> minor_tables;
+  ObGetMergeTablesResult result;
+
+  // a tier of mini sstables is merged into a new mini sstable
+  const char *mini_data =
+      "table_type    start_scn    end_scn    max_ver    upper_ver\n"
+      "12            1            150        150        150      \n"
+      "12            150          200        200        200      \n"
+      "12            200          250        250        250      \n";
+  ASSERT_EQ(OB_SUCCESS, batch_mock_sstables(mini_data, major_tables, minor_tables));
+  for (int64_t i = 0; i < minor_tables.count(); ++i) {
+    ASSERT_EQ(OB_SUCCESS, result.handle_.add_table(minor_tables.at(i)));
+  }
+  result.suggest_merge_type_ = MINI_MINOR_MERGE;
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::refine_tiered_minor_merge_result(3, 16, result));
+  ASSERT_EQ(MINI_MINOR_MERGE, result.suggest_merge_type_);
+  ASSERT_EQ(3, result.handle_.get_count());
+
+  // the tier contains the L1 sstable
+  result.reset();
+  minor_tables.reset();
+  const char *minor_data =
+      "table_type    start_scn    end_scn    max_ver    upper_ver\n"
+      "11            1            150        150        150      \n"
+      "12            150          200        200        200      \n"
+      "12            200          250        250        250      \n";
+  ASSERT_EQ(OB_SUCCESS, batch_mock_sstables(minor_data, major_tables, minor_tables));
+  for (int64_t i = 0; i < minor_tables.count(); ++i) {
+    ASSERT_EQ(OB_SUCCESS, result.handle_.add_table(minor_tables.at(i)));
+  }
+  result.suggest_merge_type_ = MINI_MINOR_MERGE;
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::refine_tiered_minor_merge_result(3, 16, result));
+  ASSERT_EQ(MINOR_MERGE, result.suggest_merge_type_);
+  ASSERT_EQ(3, result.handle_.get_count());
+
+  // chaos order is merged into L1 even though the tier is not wide enough
+  result.reset();
+  minor_tables.reset();
+  const char *chaos_data =
+      "table_type    start_scn    end_scn    max_ver    upper_ver\n"
+      "12            1            150        150        150      \n"
+      "11            150          200        200        200      \n"
+      "12            200          250        250        250      \n";
+  ASSERT_EQ(OB_SUCCESS, batch_mock_sstables(chaos_data, major_tables, minor_tables));
+  for (int64_t i = 0; i < minor_tables.count(); ++i) {
+    ASSERT_EQ(OB_SUCCESS, result.handle_.add_table(minor_tables.at(i)));
+  }
+  result.suggest_merge_type_ = MINI_MINOR_MERGE;
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::refine_tiered_minor_merge_result(4, 16, result));
+  ASSERT_EQ(MINOR_MERGE, result.suggest_merge_type_);
+  ASSERT_EQ(3, result.handle_.get_count());
+}
+
+TEST_F(TestCompactionPolicy, tiered_minor_merge_simulation)
+{
+  // row counts of the mini sstables dumped by a time series ingestion
+  const int64_t freeze_trace[] = {
+    1000, 1200,  900, 1100, 1000,  950, 1300, 1000,  800, 1000, 1100, 1050, 1000,  990, 1020,  980,
+    1000, 1500, 1000, 1000,  700, 1000, 1000, 1200, 1000, 1000, 1000, 1100,  900, 1000, 1000, 1000,
+    1000, 1200,  900, 1100, 1000,  950, 1300, 1000,  800, 1000, 1100, 1050, 1000,  990, 1020,  980,
+    1000, 1500, 1000, 1000,  700, 1000, 1000, 1200, 1000, 1000, 1000, 1100,  900, 1000, 1000, 1000};
+  const int64_t freeze_cnt = sizeof(freeze_trace) / sizeof(freeze_trace[0]);
+  const int64_t max_read_amplification = 16;
+  int64_t leveled_write_amp = 0;
+  int64_t leveled_max_table_cnt = 0;
+  int64_t tiered_write_amp = 0;
+  int64_t tiered_max_table_cnt = 0;
+
+  simulate_minor_merge(freeze_trace, freeze_cnt, 0, max_read_amplification, leveled_write_amp, leveled_max_table_cnt);
+  simulate_minor_merge(freeze_trace, freeze_cnt, 4, max_read_amplification, tiered_write_amp, tiered_max_table_cnt);
+  LOG_INFO("minor merge simulation", K(freeze_cnt), K(leveled_write_amp), K(leveled_max_table_cnt),
+           K(tiered_write_amp), K(tiered_max_table_cnt));
+  ASSERT_LT(tiered_write_amp, leveled_write_amp);
+  ASSERT_LE(tiered_max_table_cnt, max_read_amplification);
+}
 
 } //unittest
 } //oceanbase
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/compaction/ob_compaction_throttle.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace compaction;
+namespace unittest
+{
+
+class TestCompactionThrottle : public ::testing::Test
+{
+public:
+  static const int64_t RT_THRESHOLD = 10 * 1000; // 10ms
+  static const int64_t CPU_THRESHOLD = 80;
+  static const int64_t MB = 1024L * 1024L;
+  TestCompactionThrottle() {}
+  virtual ~TestCompactionThrottle() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+protected:
+  static void set_load(const int64_t rt, const int64_t cpu_usage, const int64_t write_rate,
+                       ObCompactionThrottle::Decision &decision)
+  {
+    decision.user_io_rt_ = rt;
+    decision.cpu_usage_ = cpu_usage;
+    decision.write_rate_ = write_rate;
+  }
+  static void decide(ObCompactionThrottle::Decision &decision, const bool enable = true)
+  {
+    ObCompactionThrottle::decide(enable, RT_THRESHOLD, CPU_THRESHOLD, decision);
+  }
+};
+
+TEST_F(TestCompactionThrottle, cpu_usage_percent)
+{
+  // 6 busy cpus of an 8 cpu unit
+  ASSERT_EQ(75, ObCompactionThrottle::calc_cpu_usage_percent(6, 8));
+  ASSERT_EQ(100, ObCompactionThrottle::calc_cpu_usage_percent(2, 2));
+  ASSERT_EQ(25, ObCompactionThrottle::calc_cpu_usage_percent(0.5, 2));
+  ASSERT_EQ(0, ObCompactionThrottle::calc_cpu_usage_percent(0, 8));
+  // the unit is not loaded yet
+  ASSERT_EQ(0, ObCompactionThrottle::calc_cpu_usage_percent(6, 0));
+
+  // a tenant using 6 of 8 cpus is below the threshold
+  ObCompactionThrottle::Decision decision;
+  set_load(RT_THRESHOLD / 4, ObCompactionThrottle::calc_cpu_usage_percent(6, 8), 100 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(100, decision.concurrency_percent_);
+  ASSERT_EQ(0, decision.io_limit_);
+  // and is throttled when it uses 7 of 8
+  set_load(RT_THRESHOLD / 4, ObCompactionThrottle::calc_cpu_usage_percent(7, 8), 100 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(50, decision.concurrency_percent_);
+  ASSERT_EQ(50 * MB, decision.io_limit_);
+}
+
+TEST_F(TestCompactionThrottle, disabled)
+{
+  ObCompactionThrottle::Decision decision;
+  decision.concurrency_percent_ = 20;
+  decision.io_limit_ = 32 * MB;
+  set_load(RT_THRESHOLD * 2, 100, 100 * MB, decision);
+  decide(decision, false/*enable*/);
+  ASSERT_EQ(100, decision.concurrency_percent_);
+  ASSERT_EQ(0, decision.io_limit_);
+}
+
+TEST_F(TestCompactionThrottle, busy_decrease)
+{
+  ObCompactionThrottle::Decision decision;
+  set_load(RT_THRESHOLD + 1, 0, 100 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(50, decision.concurrency_percent_);
+  ASSERT_EQ(50 * MB, decision.io_limit_);
+
+  set_load(RT_THRESHOLD + 1, 0, 50 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(25, decision.concurrency_percent_);
+  ASSERT_EQ(25 * MB, decision.io_limit_);
+
+  // bounded by the minimum
+  for (int64_t i = 0; i < 10; ++i) {
+    set_load(RT_THRESHOLD + 1, 0, decision.io_limit_, decision);
+    decide(decision);
+  }
+  ASSERT_EQ(ObCompactionThrottle::MIN_CONCURRENCY_PERCENT, decision.concurrency_percent_);
+  ASSERT_EQ(ObCompactionThrottle::MIN_IO_LIMIT, decision.io_limit_);
+
+  // the extra concurrency is given up at once
+  decision.reset();
+  decision.concurrency_percent_ = ObCompactionThrottle::MAX_CONCURRENCY_PERCENT;
+  set_load(0, CPU_THRESHOLD + 1, 100 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(50, decision.concurrency_percent_);
+}
+
+TEST_F(TestCompactionThrottle, idle_increase)
+{
+  ObCompactionThrottle::Decision decision;
+  decision.concurrency_percent_ = 80;
+  decision.io_limit_ = ObCompactionThrottle::MIN_IO_LIMIT;
+  set_load(0, 0, ObCompactionThrottle::MIN_IO_LIMIT, decision);
+  decide(decision);
+  ASSERT_EQ(90, decision.concurrency_percent_);
+  ASSERT_EQ(ObCompactionThrottle::MIN_IO_LIMIT + ObCompactionThrottle::IO_LIMIT_STEP, decision.io_limit_);
+
+  // the limit is removed when compaction no longer reaches it
+  set_load(0, 0, ObCompactionThrottle::MIN_IO_LIMIT / 2, decision);
+  decide(decision);
+  ASSERT_EQ(100, decision.concurrency_percent_);
+  ASSERT_EQ(0, decision.io_limit_);
+
+  // bounded by the maximum
+  for (int64_t i = 0; i < 20; ++i) {
+    decide(decision);
+  }
+  ASSERT_EQ(ObCompactionThrottle::MAX_CONCURRENCY_PERCENT, decision.concurrency_percent_);
+  ASSERT_EQ(0, decision.io_limit_);
+}
+
+TEST_F(TestCompactionThrottle, neither_busy_nor_idle)
+{
+  ObCompactionThrottle::Decision decision;
+  decision.concurrency_percent_ = 150;
+  set_load(RT_THRESHOLD * 3 / 4, 0, 100 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(100, decision.concurrency_percent_);
+  ASSERT_EQ(0, decision.io_limit_);
+
+  decision.concurrency_percent_ = 50;
+  decision.io_limit_ = 32 * MB;
+  set_load(0, CPU_THRESHOLD * 3 / 4, 100 * MB, decision);
+  decide(decision);
+  ASSERT_EQ(50, decision.concurrency_percent_);
+  ASSERT_EQ(32 * MB, decision.io_limit_);
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
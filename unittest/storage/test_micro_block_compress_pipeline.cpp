@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_data_macro_block_merge_writer.h"
+#include "storage/blocksstable/ob_micro_block_compress_pipeline.h"
+#include "storage/ob_sstable_struct.h"
+#include "storage/blocksstable/ob_multi_version_sstable_test.h"
+#include "storage/test_tablet_helper.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share::schema;
+using namespace blocksstable;
+using namespace unittest;
+namespace storage
+{
+
+struct MacroMetaSummary
+{
+  int64_t row_count_;
+  int64_t micro_block_count_;
+  int64_t data_checksum_;
+  int64_t data_size_;
+  int64_t data_zsize_;
+  int64_t original_size_;
+  int64_t occupy_size_;
+  TO_STRING_KV(K_(row_count), K_(micro_block_count), K_(data_checksum), K_(data_size),
+               K_(data_zsize), K_(original_size), K_(occupy_size));
+};
+
+class TestMicroBlockCompressPipeline : public ObMultiVersionSSTableTest
+{
+public:
+  static const int64_t ROW_CNT = 100000;
+  static const int64_t PAYLOAD_LEN = 200;
+
+  TestMicroBlockCompressPipeline() : ObMultiVersionSSTableTest("test_micro_block_compress_pipeline") {}
+  virtual ~TestMicroBlockCompressPipeline() {}
+  static void SetUpTestCase();
+  static void TearDownTestCase();
+
+  void prepare_schema();
+  // write ROW_CNT rows, compress inline if pipeline_depth is 0
+  void write_rows(const int64_t pipeline_depth,
+                  ObIArray<MacroMetaSummary> &macro_metas,
+                  int64_t &data_checksum);
+  void check_same(const ObIArray<MacroMetaSummary> &expect_metas,
+                  const int64_t expect_checksum,
+                  const ObIArray<MacroMetaSummary> &metas,
+                  const int64_t checksum);
+
+  static ObMicroBlockCompressPool compress_pool_;
+};
+
+ObMicroBlockCompressPool TestMicroBlockCompressPipeline::compress_pool_;
+
+void TestMicroBlockCompressPipeline::SetUpTestCase()
+{
+  ObMultiVersionSSTableTest::SetUpTestCase();
+  ObLSID ls_id(ls_id_);
+  ObTabletID tablet_id(tablet_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  obrpc::ObBatchCreateTabletArg create_tablet_arg;
+  share::schema::ObTableSchema table_schema;
+  ASSERT_EQ(OB_SUCCESS, gen_create_tablet_arg(tenant_id_, ls_id, tablet_id, create_tablet_arg, 1, &table_schema));
+  ObLSTabletService *ls_tablet_svr = ls_handle.get_ls()->get_tablet_svr();
+  ASSERT_EQ(OB_SUCCESS, TestTabletHelper::create_tablet(*ls_tablet_svr, create_tablet_arg));
+
+  ASSERT_EQ(OB_SUCCESS, compress_pool_.init());
+  ASSERT_EQ(OB_SUCCESS, compress_pool_.start());
+}
+
+void TestMicroBlockCompressPipeline::TearDownTestCase()
+{
+  compress_pool_.stop();
+  compress_pool_.wait();
+  compress_pool_.destroy();
+  ObMultiVersionSSTableTest::TearDownTestCase();
+}
+
+void TestMicroBlockCompressPipeline::prepare_schema()
+{
+  const char *micro_data[1];
+  micro_data[0] =
+      "bigint   var   bigint   bigint   bigint  var   dml           flag    multi_version_row_flag\n"
+      "0        var1  -8       0        1       v1    T_DML_INSERT  EXIST   CLF\n";
+  share::ObScnRange scn_range;
+  scn_range.start_scn_.set_min();
+  scn_range.end_scn_.convert_for_tx(10);
+  prepare_table_schema(micro_data, 2, scn_range, 10);
+  // the adaptive split of minor merge reads the compression ratio
+  ASSERT_EQ(OB_SUCCESS, table_schema_.set_compress_func_name("lz4_1.0"));
+}
+
+void TestMicroBlockCompressPipeline::write_rows(
+    const int64_t pipeline_depth,
+    ObIArray<MacroMetaSummary> &macro_metas,
+    int64_t &data_checksum)
+{
+  const int64_t snapshot_version = 10;
+  ObLSID ls_id(ls_id_);
+  ObTabletID tablet_id(tablet_id_);
+  ObSSTableMergeInfo merge_info;
+  ObDataMacroBlockMergeWriter writer;
+  ObMacroDataSeq start_seq(0);
+  start_seq.set_data_block();
+  macro_metas.reset();
+  data_checksum = 0;
+
+  if (nullptr != root_index_builder_) {
+    root_index_builder_->~ObSSTableIndexBuilder();
+    allocator_.free((void *)root_index_builder_);
+  }
+  root_index_builder_ = new (allocator_.alloc(sizeof(ObSSTableIndexBuilder))) ObSSTableIndexBuilder();
+  ASSERT_NE(nullptr, root_index_builder_);
+  data_desc_.reset();
+  ASSERT_EQ(OB_SUCCESS, data_desc_.init(table_schema_, ls_id, tablet_id, merge_type_, snapshot_version, 1000000));
+  data_desc_.sstable_index_builder_ = root_index_builder_;
+  data_desc_.need_prebuild_bloomfilter_ = false;
+  data_desc_.row_store_type_ = row_store_type_;
+  data_desc_.merge_info_ = &merge_info;
+  index_desc_.reset();
+  ASSERT_EQ(OB_SUCCESS, index_desc_.init(index_schema_, ls_id, tablet_id, merge_type_, snapshot_version, 1000000));
+  ASSERT_EQ(OB_SUCCESS, root_index_builder_->init(index_desc_));
+  ASSERT_EQ(OB_SUCCESS, writer.open(data_desc_, start_seq));
+
+  // the compress pool of the test tenant is not registered, use the pool of the test
+  ASSERT_TRUE(nullptr == writer.compress_pipeline_);
+  if (pipeline_depth > 0) {
+    writer.compress_pipeline_ = OB_NEWx(ObMicroBlockCompressPipeline, &writer.allocator_);
+    ASSERT_NE(nullptr, writer.compress_pipeline_);
+    ASSERT_EQ(OB_SUCCESS, writer.compress_pipeline_->init(
+        *writer.data_store_desc_, writer.read_info_, compress_pool_, pipeline_depth));
+  }
+
+  ObDatumRow row;
+  char payload[PAYLOAD_LEN];
+  char rowkey[32];
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_read_info_.get_request_count()));
+  uint64_t seed = 1;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    // the compression ratio changes from row to row
+    const int64_t random_len = (i / 97) % PAYLOAD_LEN;
+    for (int64_t j = 0; j < PAYLOAD_LEN; ++j) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      payload[j] = j < random_len ? static_cast<char>('a' + (seed >> 59)) : 'x';
+    }
+    snprintf(rowkey, sizeof(rowkey), "key%016ld", i);
+    row.reuse();
+    row.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+    row.mvcc_row_flag_.set_compacted_multi_version_row(true);
+    row.mvcc_row_flag_.set_first_multi_version_row(true);
+    row.mvcc_row_flag_.set_last_multi_version_row(true);
+    row.storage_datums_[0].set_int(i / 10);
+    row.storage_datums_[1].set_string(rowkey, static_cast<int32_t>(strlen(rowkey)));
+    row.storage_datums_[2].set_int(-8);
+    row.storage_datums_[3].set_int(0);
+    row.storage_datums_[4].set_int(i * 7);
+    row.storage_datums_[5].set_string(payload, PAYLOAD_LEN);
+    ASSERT_EQ(OB_SUCCESS, writer.append_row(row));
+  }
+  ASSERT_EQ(OB_SUCCESS, writer.close());
+  if (pipeline_depth > 0) {
+    ASSERT_TRUE(writer.compress_pipeline_->is_empty());
+  }
+
+  ASSERT_EQ(1, root_index_builder_->roots_.count());
+  const ObMacroMetasArray *metas = root_index_builder_->roots_.at(0)->macro_metas_;
+  ASSERT_NE(nullptr, metas);
+  for (int64_t i = 0; i < metas->count(); ++i) {
+    const ObDataBlockMetaVal &val = metas->at(i)->val_;
+    MacroMetaSummary summary;
+    summary.row_count_ = val.row_count_;
+    summary.micro_block_count_ = val.micro_block_count_;
+    summary.data_checksum_ = val.data_checksum_;
+    summary.data_size_ = val.data_size_;
+    summary.data_zsize_ = val.data_zsize_;
+    summary.original_size_ = val.original_size_;
+    summary.occupy_size_ = val.occupy_size_;
+    ASSERT_EQ(OB_SUCCESS, macro_metas.push_back(summary));
+  }
+  ObSSTableMergeRes res;
+  const int64_t column_cnt =
+      table_schema_.get_column_count() + ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  ASSERT_EQ(OB_SUCCESS, root_index_builder_->close(column_cnt, res));
+  ASSERT_EQ(ROW_CNT, res.row_count_);
+  ASSERT_EQ(macro_metas.count(), res.data_blocks_cnt_);
+  data_checksum = res.data_checksum_;
+  STORAGE_LOG(INFO, "write rows", K(pipeline_depth), K(macro_metas), K(data_checksum), K(merge_info));
+  writer.reset();
+}
+
+void TestMicroBlockCompressPipeline::check_same(
+    const ObIArray<MacroMetaSummary> &expect_metas,
+    const int64_t expect_checksum,
+    const ObIArray<MacroMetaSummary> &metas,
+    const int64_t checksum)
+{
+  ASSERT_EQ(expect_checksum, checksum);
+  ASSERT_EQ(expect_metas.count(), metas.count());
+  for (int64_t i = 0; i < metas.count(); ++i) {
+    const MacroMetaSummary &expect = expect_metas.at(i);
+    const MacroMetaSummary &meta = metas.at(i);
+    ASSERT_EQ(expect.row_count_, meta.row_count_) << "macro " << i;
+    ASSERT_EQ(expect.micro_block_count_, meta.micro_block_count_) << "macro " << i;
+    ASSERT_EQ(expect.data_checksum_, meta.data_checksum_) << "macro " << i;
+    ASSERT_EQ(expect.data_size_, meta.data_size_) << "macro " << i;
+    ASSERT_EQ(expect.data_zsize_, meta.data_zsize_) << "macro " << i;
+    ASSERT_EQ(expect.original_size_, meta.original_size_) << "macro " << i;
+    ASSERT_EQ(expect.occupy_size_, meta.occupy_size_) << "macro " << i;
+  }
+}
+
+TEST_F(TestMicroBlockCompressPipeline, same_layout_with_any_depth)
+{
+  ObSEArray<MacroMetaSummary, 16> expect_metas;
+  ObSEArray<MacroMetaSummary, 16> metas;
+  int64_t expect_checksum = 0;
+  int64_t checksum = 0;
+  prepare_schema();
+
+  write_rows(0, expect_metas, expect_checksum);
+  ASSERT_GT(expect_metas.count(), 1);
+
+  const int64_t depths[] = {1, 4, ObMicroBlockCompressPipeline::MAX_TASK_CNT};
+  for (int64_t i = 0; i < ARRAYSIZEOF(depths); ++i) {
+    write_rows(depths[i], metas, checksum);
+    check_same(expect_metas, expect_checksum, metas, checksum);
+  }
+}
+
+TEST_F(TestMicroBlockCompressPipeline, same_layout_after_pool_stopped)
+{
+  ObSEArray<MacroMetaSummary, 16> expect_metas;
+  ObSEArray<MacroMetaSummary, 16> metas;
+  int64_t expect_checksum = 0;
+  int64_t checksum = 0;
+  prepare_schema();
+
+  write_rows(0, expect_metas, expect_checksum);
+  // the tasks are compressed by the merge thread when they are written
+  compress_pool_.stop();
+  compress_pool_.wait();
+  ASSERT_TRUE(compress_pool_.has_stopped());
+  write_rows(ObMicroBlockCompressPipeline::MAX_TASK_CNT, metas, checksum);
+  check_same(expect_metas, expect_checksum, metas, checksum);
+}
+
+} // end namespace storage
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_micro_block_compress_pipeline.log*");
+  OB_LOGGER.set_file_name("test_micro_block_compress_pipeline.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,400 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/compaction/ob_partition_merger.h"
+#include "storage/compaction/ob_tablet_merge_ctx.h"
+#include "storage/compaction/ob_tablet_merge_task.h"
+#include "storage/blocksstable/ob_multi_version_sstable_test.h"
+#include "storage/test_tablet_helper.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share::schema;
+using namespace blocksstable;
+using namespace compaction;
+using namespace unittest;
+namespace storage
+{
+
+// Minor merge with micro block reuse (MICRO_BLOCK_MERGE_LEVEL, _enable_minor_micro_block_reuse on)
+// must write the same rows with the same multi-version flags as the merge opening whole macro
+// blocks (MACRO_BLOCK_MERGE_LEVEL, the config off).
+class TestMinorMicroBlockReuse : public ObMultiVersionSSTableTest
+{
+public:
+  // two rows fill more than half of a micro block, so the micro block is worth reusing
+  static const int64_t VALUE_LEN = 560;
+  static const int64_t MICRO_DATA_LEN = 4096;
+
+  TestMinorMicroBlockReuse() : ObMultiVersionSSTableTest("test_minor_micro_block_reuse") {}
+  virtual ~TestMinorMicroBlockReuse() {}
+  static void SetUpTestCase();
+  static void TearDownTestCase();
+  virtual void TearDown() override;
+
+  // replace each %s of the template with a long value
+  void format_micro_data(const char *tmpl, char *buf);
+  void prepare_sstable(const char **micro_data,
+                       const int64_t micro_cnt,
+                       const int64_t start_scn,
+                       const int64_t end_scn,
+                       ObTableHandleV2 &handle);
+  void prepare_merge_context(const ObMergeLevel merge_level,
+                             const ObVersionRange &version_range,
+                             ObTabletMergeCtx &merge_context);
+  void merge(const ObMergeLevel merge_level,
+             const ObVersionRange &version_range,
+             ObTableHandleV2 &merged_handle,
+             int64_t &reused_micro_cnt);
+  void read_rows(ObTableHandleV2 &handle, ObMockIterator &rows);
+  // merge with and without micro block reuse and compare the rows
+  void check_reuse_same_as_rewrite(const ObVersionRange &version_range, int64_t &reused_micro_cnt);
+
+  ObStorageSchema table_merge_schema_;
+  ObStoreCtx store_ctx_;
+  ObSEArray<ObTableHandleV2, 4> tables_;
+  char value_[VALUE_LEN + 1];
+};
+
+void TestMinorMicroBlockReuse::SetUpTestCase()
+{
+  ObMultiVersionSSTableTest::SetUpTestCase();
+  // mock sequence no
+  ObClockGenerator::init();
+
+  ObLSID ls_id(ls_id_);
+  ObTabletID tablet_id(tablet_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+
+  obrpc::ObBatchCreateTabletArg create_tablet_arg;
+  share::schema::ObTableSchema table_schema;
+  ASSERT_EQ(OB_SUCCESS, gen_create_tablet_arg(tenant_id_, ls_id, tablet_id, create_tablet_arg, 1, &table_schema));
+  ObLSTabletService *ls_tablet_svr = ls_handle.get_ls()->get_tablet_svr();
+  ASSERT_EQ(OB_SUCCESS, TestTabletHelper::create_tablet(*ls_tablet_svr, create_tablet_arg));
+}
+
+void TestMinorMicroBlockReuse::TearDownTestCase()
+{
+  ObMultiVersionSSTableTest::TearDownTestCase();
+  ObClockGenerator::destroy();
+}
+
+void TestMinorMicroBlockReuse::TearDown()
+{
+  tables_.reset();
+  store_ctx_.reset();
+  ObMultiVersionSSTableTest::TearDown();
+}
+
+void TestMinorMicroBlockReuse::format_micro_data(const char *tmpl, char *buf)
+{
+  MEMSET(value_, 'v', VALUE_LEN);
+  value_[VALUE_LEN] = '\0';
+  snprintf(buf, MICRO_DATA_LEN, tmpl, value_, value_, value_, value_);
+}
+
+void TestMinorMicroBlockReuse::prepare_sstable(
+    const char **micro_data,
+    const int64_t micro_cnt,
+    const int64_t start_scn,
+    const int64_t end_scn,
+    ObTableHandleV2 &handle)
+{
+  share::ObScnRange scn_range;
+  if (0 == start_scn) {
+    scn_range.start_scn_.set_min();
+  } else {
+    scn_range.start_scn_.convert_for_tx(start_scn);
+  }
+  scn_range.end_scn_.convert_for_tx(end_scn);
+  if (tables_.empty()) {
+    prepare_table_schema(micro_data, 1/*schema rowkey cnt*/, scn_range, end_scn);
+  }
+  table_key_.scn_range_ = scn_range;
+  reset_writer(end_scn);
+  prepare_one_macro(micro_data, micro_cnt);
+  prepare_data_end(handle);
+  OK(tables_.push_back(handle));
+}
+
+void TestMinorMicroBlockReuse::prepare_merge_context(
+    const ObMergeLevel merge_level,
+    const ObVersionRange &version_range,
+    ObTabletMergeCtx &merge_context)
+{
+  ObLSID ls_id(ls_id_);
+  ObTabletID tablet_id(tablet_id_);
+  ObLSHandle ls_handle;
+  ObLSService *ls_svr = MTL(ObLSService*);
+  ASSERT_EQ(OB_SUCCESS, ls_svr->get_ls(ls_id, ls_handle, ObLSGetMod::STORAGE_MOD));
+  merge_context.ls_handle_ = ls_handle;
+
+  ObTabletHandle tablet_handle;
+  ASSERT_EQ(OB_SUCCESS, ls_handle.get_ls()->get_tablet(tablet_id, tablet_handle));
+  merge_context.tablet_handle_ = tablet_handle;
+
+  table_merge_schema_.reset();
+  OK(table_merge_schema_.init(allocator_, table_schema_, lib::Worker::CompatMode::MYSQL));
+  merge_context.schema_ctx_.base_schema_version_ = table_schema_.get_schema_version();
+  merge_context.schema_ctx_.schema_version_ = table_schema_.get_schema_version();
+  merge_context.schema_ctx_.storage_schema_ = &table_merge_schema_;
+  merge_context.schema_ctx_.merge_schema_ = &table_merge_schema_;
+  merge_context.schema_ctx_.table_schema_ = &table_schema_;
+
+  for (int64_t i = 0; i < tables_.count(); ++i) {
+    OK(merge_context.tables_handle_.add_table(tables_.at(i)));
+  }
+  merge_context.is_full_merge_ = false;
+  merge_context.merge_level_ = merge_level;
+  merge_context.param_.merge_type_ = MINOR_MERGE;
+  merge_context.param_.merge_version_ = 0;
+  merge_context.param_.ls_id_ = ls_id_;
+  merge_context.param_.tablet_id_ = tablet_id_;
+  merge_context.param_.report_ = &rs_reporter_;
+  merge_context.sstable_version_range_ = version_range;
+  merge_context.progressive_merge_num_ = 0;
+  const common::ObIArray<ObITable *> &tables = merge_context.tables_handle_.get_tables();
+  merge_context.scn_range_.start_scn_ = tables.at(0)->get_start_scn();
+  merge_context.scn_range_.end_scn_ = tables.at(tables.count() - 1)->get_end_scn();
+  merge_context.merge_scn_ = merge_context.scn_range_.end_scn_;
+  ASSERT_EQ(OB_SUCCESS, merge_context.parallel_merge_ctx_.init_serial_merge());
+  merge_context.parallel_merge_ctx_.is_inited_ = true;
+
+  ASSERT_EQ(OB_SUCCESS, merge_context.init_merge_info());
+  ASSERT_EQ(OB_SUCCESS, merge_context.merge_info_.prepare_index_builder(index_desc_));
+}
+
+void TestMinorMicroBlockReuse::merge(
+    const ObMergeLevel merge_level,
+    const ObVersionRange &version_range,
+    ObTableHandleV2 &merged_handle,
+    int64_t &reused_micro_cnt)
+{
+  ObTabletMergeDagParam param;
+  ObTabletMergeCtx merge_context(param, allocator_);
+  ObPartitionMinorMerger merger;
+  prepare_merge_context(merge_level, version_range, merge_context);
+  ASSERT_EQ(OB_SUCCESS, merger.merge_partition(merge_context, 0));
+  ASSERT_EQ(OB_SUCCESS, merge_context.merge_info_.create_sstable(merge_context));
+  merged_handle = merge_context.merged_table_handle_;
+  reused_micro_cnt = merge_context.merge_info_.get_sstable_merge_info().multiplexed_micro_count_in_new_macro_;
+  STORAGE_LOG(INFO, "finish minor merge", K(merge_level), K(reused_micro_cnt),
+              "merge_info", merge_context.merge_info_.get_sstable_merge_info());
+}
+
+// read the rows as they are stored, with the multi-version flags
+void TestMinorMicroBlockReuse::read_rows(ObTableHandleV2 &handle, ObMockIterator &rows)
+{
+  int ret = OB_SUCCESS;
+  ObSSTable *sstable = nullptr;
+  ObStoreRowIterator *scanner = nullptr;
+  ObMockDirectReadIterator sstable_iter;
+  ObDatumRange range;
+  ObVersionRange version_range;
+  const ObStoreRow *row = nullptr;
+  version_range.base_version_ = 0;
+  version_range.multi_version_start_ = 0;
+  version_range.snapshot_version_ = INT64_MAX - 2;
+  range.set_whole_range();
+  rows.reset();
+
+  ASSERT_EQ(OB_SUCCESS, handle.get_sstable(sstable));
+  iter_param_.table_id_ = table_id_;
+  iter_param_.tablet_id_ = tablet_id_;
+  iter_param_.read_info_ = &full_read_info_;
+  iter_param_.full_read_info_ = &full_read_info_;
+  iter_param_.out_cols_project_ = nullptr;
+  iter_param_.is_same_schema_column_ = true;
+  iter_param_.has_virtual_columns_ = false;
+  iter_param_.vectorized_enabled_ = false;
+  store_ctx_.reset();
+  ASSERT_EQ(OB_SUCCESS, store_ctx_.init_for_read(ObLSID(ls_id_), INT64_MAX, -1, share::SCN::max_scn()));
+  ObQueryFlag query_flag(ObQueryFlag::Forward,
+                         true, /*is daily merge scan*/
+                         true, /*is read multiple macro block*/
+                         true, /*sys task scan, read one macro block in single io*/
+                         false /*full row scan flag, obsoleted*/,
+                         false,/*index back*/
+                         false); /*query_stat*/
+  query_flag.multi_version_minor_merge_ = true;
+  query_flag.set_not_use_row_cache();
+  context_.reset();
+  ASSERT_EQ(OB_SUCCESS, context_.init(query_flag, store_ctx_, allocator_, allocator_, version_range));
+
+  ASSERT_EQ(OB_SUCCESS, sstable->scan(iter_param_, context_, range, scanner));
+  ASSERT_EQ(OB_SUCCESS, sstable_iter.init(scanner, allocator_, full_read_info_));
+  while (OB_SUCC(sstable_iter.get_next_row(row))) {
+    ASSERT_EQ(OB_SUCCESS, rows.add_row(const_cast<ObStoreRow *>(row)));
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+  scanner->~ObStoreRowIterator();
+}
+
+void TestMinorMicroBlockReuse::check_reuse_same_as_rewrite(
+    const ObVersionRange &version_range,
+    int64_t &reused_micro_cnt)
+{
+  ObTableHandleV2 rewrite_handle;
+  ObTableHandleV2 reuse_handle;
+  ObMockIterator rewrite_rows;
+  ObMockIterator reuse_rows;
+  int64_t rewrite_reused_micro_cnt = 0;
+
+  merge(MACRO_BLOCK_MERGE_LEVEL, version_range, rewrite_handle, rewrite_reused_micro_cnt);
+  merge(MICRO_BLOCK_MERGE_LEVEL, version_range, reuse_handle, reused_micro_cnt);
+  // the overlapped macro blocks are rewritten as a whole with the config off
+  ASSERT_EQ(0, rewrite_reused_micro_cnt);
+
+  read_rows(rewrite_handle, rewrite_rows);
+  read_rows(reuse_handle, reuse_rows);
+  ASSERT_GT(rewrite_rows.count(), 0);
+  ASSERT_EQ(rewrite_rows.count(), reuse_rows.count());
+  rewrite_rows.reset_iter();
+  reuse_rows.reset_iter();
+  ASSERT_TRUE(rewrite_rows.equals(reuse_rows, true/*cmp multi version row flag*/));
+}
+
+TEST_F(TestMinorMicroBlockReuse, reused_micro_next_to_opened)
+{
+  char micro_buf[3][MICRO_DATA_LEN];
+  const char *micro_data[3];
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "0        -8      0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "1        -8      0        %s    T_DML_INSERT  EXIST   CLF\n", micro_buf[0]);
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "2        -8      0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "3        -8      0        %s    T_DML_INSERT  EXIST   CLF\n", micro_buf[1]);
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "4        -8      0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "5        -8      0        %s    T_DML_INSERT  EXIST   CLF\n", micro_buf[2]);
+  for (int64_t i = 0; i < 3; ++i) {
+    micro_data[i] = micro_buf[i];
+  }
+  ObTableHandleV2 handle1;
+  prepare_sstable(micro_data, 3, 0, 10, handle1);
+
+  // only overlaps the second micro block
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "3        -15     0        %s    T_DML_UPDATE  EXIST   CLF\n", micro_buf[0]);
+  ObTableHandleV2 handle2;
+  prepare_sstable(micro_data, 1, 10, 20, handle2);
+
+  ObVersionRange version_range;
+  version_range.base_version_ = 1;
+  version_range.multi_version_start_ = 1;
+  version_range.snapshot_version_ = 100;
+  int64_t reused_micro_cnt = 0;
+  check_reuse_same_as_rewrite(version_range, reused_micro_cnt);
+  ASSERT_GT(reused_micro_cnt, 0);
+}
+
+TEST_F(TestMinorMicroBlockReuse, rowkey_across_micro_blocks)
+{
+  char micro_buf[3][MICRO_DATA_LEN];
+  const char *micro_data[3];
+  // the first micro block ends in the middle of rowkey 1, with its first and shadow rows
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "0        -10     0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "1        -10     MIN      %s    T_DML_UPDATE  EXIST   SCF\n"
+      "1        -10     0        %s    T_DML_UPDATE  EXIST   N\n", micro_buf[0]);
+  // the rest versions of rowkey 1 are below the base version, the micro block is opened
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "1        -6      0        %s    T_DML_UPDATE  EXIST   N\n"
+      "1        -2      0        %s    T_DML_INSERT  EXIST   CL\n", micro_buf[1]);
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "2        -10     0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "3        -10     0        %s    T_DML_INSERT  EXIST   CLF\n", micro_buf[2]);
+  for (int64_t i = 0; i < 3; ++i) {
+    micro_data[i] = micro_buf[i];
+  }
+  ObTableHandleV2 handle1;
+  prepare_sstable(micro_data, 3, 0, 10, handle1);
+
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "3        -15     0        %s    T_DML_UPDATE  EXIST   CLF\n", micro_buf[0]);
+  ObTableHandleV2 handle2;
+  prepare_sstable(micro_data, 1, 10, 20, handle2);
+
+  ObVersionRange version_range;
+  version_range.base_version_ = 7;
+  version_range.multi_version_start_ = 7;
+  version_range.snapshot_version_ = 100;
+  int64_t reused_micro_cnt = 0;
+  check_reuse_same_as_rewrite(version_range, reused_micro_cnt);
+  ASSERT_GT(reused_micro_cnt, 0);
+}
+
+TEST_F(TestMinorMicroBlockReuse, recycle_border_versions)
+{
+  char micro_buf[3][MICRO_DATA_LEN];
+  const char *micro_data[3];
+  // max version below the base version
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "0        -4      0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "1        -4      0        %s    T_DML_UPDATE  EXIST   CF\n", micro_buf[0]);
+  // max version equal to the base version
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "1        -2      0        %s    T_DML_INSERT  EXIST   CL\n"
+      "2        -6      0        %s    T_DML_INSERT  EXIST   CLF\n", micro_buf[1]);
+  // max version above the base version
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "3        -8      0        %s    T_DML_INSERT  EXIST   CLF\n"
+      "4        -8      0        %s    T_DML_INSERT  EXIST   CLF\n", micro_buf[2]);
+  for (int64_t i = 0; i < 3; ++i) {
+    micro_data[i] = micro_buf[i];
+  }
+  ObTableHandleV2 handle1;
+  prepare_sstable(micro_data, 3, 0, 10, handle1);
+
+  format_micro_data(
+      "bigint   bigint  bigint   var   dml           flag    multi_version_row_flag\n"
+      "4        -15     0        %s    T_DML_UPDATE  EXIST   CLF\n", micro_buf[0]);
+  ObTableHandleV2 handle2;
+  prepare_sstable(micro_data, 1, 10, 20, handle2);
+
+  ObVersionRange version_range;
+  version_range.base_version_ = 6;
+  version_range.multi_version_start_ = 6;
+  version_range.snapshot_version_ = 100;
+  int64_t reused_micro_cnt = 0;
+  check_reuse_same_as_rewrite(version_range, reused_micro_cnt);
+}
+
+} // end namespace storage
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_minor_micro_block_reuse.log*");
+  OB_LOGGER.set_file_name("test_minor_micro_block_reuse.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}